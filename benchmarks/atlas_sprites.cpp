@@ -0,0 +1,118 @@
+// Compares the draw data of 1k toggles tessellated as usual against the same toggles drawn with sprites baked into the font atlas. See BENCHMARK.md.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include "benchmark_harness.h"
+
+#include <cstdio>
+#include <memory>
+
+static const int Count = 1000;
+static const int Columns = 50;
+static const int MeasuredFrames = 200;
+
+struct SpriteCase
+{
+	const char* Name;
+	ImGuiToggleFlags Flags;
+	ImGuiToggleA11yStyle A11yStyle;
+	float ShadowThickness;
+};
+
+// counts the vertices sampling the atlas away from its white pixel, which only sprites do here as the toggles have no labels.
+static int count_sprite_vertices(const ImDrawData* draw_data, const ImVec2& white_pixel)
+{
+	int count = 0;
+
+	for (int i = 0; i < draw_data->CmdListsCount; ++i)
+	{
+		const ImDrawList* draw_list = draw_data->CmdLists[i];
+		for (int v = 0; v < draw_list->VtxBuffer.Size; ++v)
+		{
+			const ImVec2 uv = draw_list->VtxBuffer[v].uv;
+			count += (uv.x != white_pixel.x || uv.y != white_pixel.y) ? 1 : 0;
+		}
+	}
+
+	return count;
+}
+
+static void run_case(const SpriteCase& sprite_case, bool use_sprites)
+{
+	create_headless_context();
+	ImGuiIO& io = ImGui::GetIO();
+
+	// the sprites' rects are added before the atlas is built, and drawn into its pixels right after.
+	if (use_sprites)
+	{
+		ImGui::AddToggleSpritesToFontAtlas();
+	}
+
+	unsigned char* pixels = nullptr;
+	int width = 0, height = 0;
+	io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+	if (use_sprites && !ImGui::BakeToggleSprites())
+	{
+		printf("# %s: sprites could not be baked\n", sprite_case.Name);
+	}
+
+	ImGuiToggleConfig config;
+	config.Flags = sprite_case.Flags;
+	config.A11yStyle = sprite_case.A11yStyle;
+	config.On.FrameShadowThickness = config.Off.FrameShadowThickness = sprite_case.ShadowThickness;
+	config.On.KnobShadowThickness = config.Off.KnobShadowThickness = sprite_case.ShadowThickness;
+
+	std::unique_ptr<bool[]> values(new bool[Count]());
+	for (int i = 0; i < Count; ++i)
+	{
+		values[i] = (i % 2) == 0;
+	}
+
+	const FrameResults results = run_frames(MeasuredFrames, ImGuiWindowFlags_NoDecoration, [&](int)
+	{
+		for (int i = 0; i < Count; ++i)
+		{
+			if (i % Columns != 0)
+			{
+				ImGui::SameLine();
+			}
+
+			ImGui::PushID(i);
+			ImGui::Toggle("##value", &values[i], config);
+			ImGui::PopID();
+		}
+	});
+
+	const int sprite_vertices = count_sprite_vertices(ImGui::GetDrawData(), io.Fonts->TexUvWhitePixel);
+
+	printf("sprites,%s,%s,%d,%.2f,%.1f,%.1f,%d,%dx%d\n", sprite_case.Name, use_sprites ? "sprites" : "tessellated", Count,
+		results.NsPerFrame() / Count, (double)results.Vertices / Count, (double)results.Indices / Count, sprite_vertices, width, height);
+
+	end_headless_context();
+}
+
+int main()
+{
+	// `wide_shadowed` draws shadows 8 pixels wide, to show that sprite shadows cost the same at any width.
+	const SpriteCase cases[] =
+	{
+		{ "default", ImGuiToggleFlags_None, ImGuiToggleA11yStyle_Default, ImGuiToggleConstants::ShadowThicknessDefault },
+		{ "bordered", ImGuiToggleFlags_Bordered, ImGuiToggleA11yStyle_Default, ImGuiToggleConstants::ShadowThicknessDefault },
+		{ "shadowed", ImGuiToggleFlags_Shadowed, ImGuiToggleA11yStyle_Default, ImGuiToggleConstants::ShadowThicknessDefault },
+		{ "wide_shadowed", ImGuiToggleFlags_Shadowed, ImGuiToggleA11yStyle_Default, 8.0f },
+		{ "bordered_shadowed", ImGuiToggleFlags_Bordered | ImGuiToggleFlags_Shadowed, ImGuiToggleA11yStyle_Default, ImGuiToggleConstants::ShadowThicknessDefault },
+		{ "a11y_glyph", ImGuiToggleFlags_A11y, ImGuiToggleA11yStyle_Glyph, ImGuiToggleConstants::ShadowThicknessDefault },
+	};
+
+	printf("benchmark,case,mode,count,ns_per_toggle,vertices_per_toggle,indices_per_toggle,sprite_vertices,atlas_size\n");
+
+	for (const SpriteCase& sprite_case : cases)
+	{
+		run_case(sprite_case, false);
+		run_case(sprite_case, true);
+	}
+
+	return 0;
+}
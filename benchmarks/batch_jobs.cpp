@@ -0,0 +1,114 @@
+// Draws 10k toggles a frame inside a toggle batch, with the batch's vertices written by 1 up to the number of hardware threads. See BENCHMARK.md.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include "benchmark_harness.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+static const int Columns = 100;
+static const int Count = 10000;
+static const int MeasuredFrames = 200;
+static const int FlipIntervalFrames = 4;
+
+// splits the jobs between short-lived threads. a real application would use its own thread pool.
+static void dispatch_on_threads(ImGuiToggleJobFunction job, void* job_data, int job_count, void* user_data)
+{
+	const int thread_count = std::min(*static_cast<int*>(user_data), job_count);
+	std::vector<std::thread> threads;
+
+	for (int t = 1; t < thread_count; ++t)
+	{
+		threads.emplace_back([=]()
+		{
+			for (int i = t; i < job_count; i += thread_count)
+			{
+				job(job_data, i);
+			}
+		});
+	}
+
+	// the calling thread takes its share too.
+	for (int i = 0; i < job_count; i += thread_count)
+	{
+		job(job_data, i);
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
+
+int main()
+{
+	using clock = std::chrono::steady_clock;
+	const int max_threads = std::max(1, (int)std::thread::hardware_concurrency());
+
+	printf("benchmark,threads,count,ns_per_frame,ns_per_end_batch,vertices,indices\n");
+
+	for (int thread_count = 1; thread_count <= max_threads; ++thread_count)
+	{
+		// the display is large enough that every toggle is visible.
+		begin_headless_context(ImVec2(4096.0f, 4096.0f));
+		ImGui::SetToggleJobDispatcher(dispatch_on_threads, &thread_count);
+
+		std::unique_ptr<bool[]> values(new bool[Count]());
+		double end_batch_ns = 0.0;
+
+		// the toggles animate continuously, so some of their shapes are tessellated for every batch.
+		const FrameResults results = run_frames(MeasuredFrames, ImGuiWindowFlags_NoDecoration,
+			[&](int frame)
+			{
+				if (frame % FlipIntervalFrames == 0)
+				{
+					for (int i = 0; i < Count; i += 2)
+					{
+						values[i] = !values[i];
+					}
+				}
+			},
+			[&](int frame)
+			{
+				ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(1.0f, 1.0f));
+
+				ImGui::BeginToggleBatch();
+				for (int i = 0; i < Count; ++i)
+				{
+					if (i % Columns != 0)
+					{
+						ImGui::SameLine();
+					}
+
+					ImGui::PushID(i);
+					ImGui::Toggle("##value", &values[i], ImGuiToggleFlags_Animated | ImGuiToggleFlags_Bordered, ImVec2(32.0f, 20.0f));
+					ImGui::PopID();
+				}
+
+				// the end of the batch is timed on its own too, as it's the part the jobs speed up.
+				const clock::time_point end_batch_start = clock::now();
+				ImGui::EndToggleBatch();
+				const clock::time_point end_batch_end = clock::now();
+
+				if (frame >= WarmupFrames)
+				{
+					end_batch_ns += elapsed_ns(end_batch_start, end_batch_end);
+				}
+
+				ImGui::PopStyleVar();
+			});
+
+		end_headless_context();
+
+		printf("batch_jobs,%d,%d,%.0f,%.0f,%d,%d\n", thread_count, Count, results.NsPerFrame(), end_batch_ns / MeasuredFrames, results.Vertices, results.Indices);
+		fflush(stdout);
+	}
+
+	return 0;
+}
@@ -0,0 +1,130 @@
+// Shared by the benchmarks: a headless Dear ImGui context, an allocation counter, and a timed frame loop, so every benchmark measures frames the same way.
+
+#pragma once
+
+#include "imgui.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+static const int WarmupFrames = 10;
+
+// what Dear ImGui allocated, once use_counting_allocator() is called. the counts aren't atomic, so only count allocations made on one thread.
+static size_t AllocationCount = 0;
+static size_t AllocationBytes = 0;
+
+static inline void* counting_alloc(size_t size, void* user_data)
+{
+	(void)user_data;
+	++AllocationCount;
+	AllocationBytes += size;
+	return malloc(size);
+}
+
+static inline void counting_free(void* ptr, void* user_data)
+{
+	(void)user_data;
+	free(ptr);
+}
+
+static inline void use_counting_allocator()
+{
+	ImGui::SetAllocatorFunctions(counting_alloc, counting_free);
+}
+
+// creates a context with no renderer backend, for a display of `display_size` running at 60 frames a second.
+// its font atlas isn't built yet, so more rects can still be added to it.
+static inline void create_headless_context(const ImVec2& display_size = ImVec2(1920.0f, 1080.0f))
+{
+	ImGui::CreateContext();
+	ImGuiIO& io = ImGui::GetIO();
+	io.DisplaySize = display_size;
+	io.DeltaTime = 1.0f / 60.0f;
+}
+
+// builds the font atlas in memory, there is no renderer backend to upload it to.
+static inline void build_headless_font_atlas()
+{
+	unsigned char* pixels = nullptr;
+	int width = 0, height = 0;
+	ImGui::GetIO().Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+}
+
+static inline void begin_headless_context(const ImVec2& display_size = ImVec2(1920.0f, 1080.0f))
+{
+	create_headless_context(display_size);
+	build_headless_font_atlas();
+}
+
+static inline void end_headless_context()
+{
+	ImGui::DestroyContext();
+}
+
+static inline double elapsed_ns(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+	return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+struct FrameResults
+{
+	int MeasuredFrames = 0;
+	double TotalNs = 0.0;                   // The time taken by the measured frames.
+	double SlowestNs = 0.0;                 // The slowest frame, warmup included.
+	int Vertices = 0;                       // The vertices and indices in the last frame's draw data.
+	int Indices = 0;
+	size_t Allocations = 0;                 // Counted over the measured frames, see use_counting_allocator().
+	size_t AllocatedBytes = 0;
+
+	double NsPerFrame() const { return TotalNs / MeasuredFrames; }
+};
+
+// runs `WarmupFrames` and then `measured_frames` frames in the current context, each drawing a window covering the display with `draw(frame)`.
+// `prepare(frame)` runs before each frame starts, and isn't timed.
+template <typename Prepare, typename Draw>
+static FrameResults run_frames(int measured_frames, ImGuiWindowFlags window_flags, Prepare prepare, Draw draw)
+{
+	using clock = std::chrono::steady_clock;
+
+	FrameResults results;
+	results.MeasuredFrames = measured_frames;
+
+	for (int frame = 0; frame < WarmupFrames + measured_frames; ++frame)
+	{
+		prepare(frame);
+
+		const size_t allocations_before = AllocationCount;
+		const size_t allocated_bytes_before = AllocationBytes;
+		const clock::time_point start = clock::now();
+
+		ImGui::NewFrame();
+		ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+		ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+		ImGui::Begin("Benchmark", nullptr, window_flags);
+		draw(frame);
+		ImGui::End();
+		ImGui::Render();
+
+		const clock::time_point end = clock::now();
+		const double frame_ns = elapsed_ns(start, end);
+		results.SlowestNs = std::max(results.SlowestNs, frame_ns);
+
+		if (frame >= WarmupFrames)
+		{
+			results.TotalNs += frame_ns;
+			results.Allocations += AllocationCount - allocations_before;
+			results.AllocatedBytes += AllocationBytes - allocated_bytes_before;
+			results.Vertices = ImGui::GetDrawData()->TotalVtxCount;
+			results.Indices = ImGui::GetDrawData()->TotalIdxCount;
+		}
+	}
+
+	return results;
+}
+
+template <typename Draw>
+static FrameResults run_frames(int measured_frames, ImGuiWindowFlags window_flags, Draw draw)
+{
+	return run_frames(measured_frames, window_flags, [](int) {}, draw);
+}
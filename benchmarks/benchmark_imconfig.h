@@ -0,0 +1,8 @@
+// Dear ImGui user config for the multithreaded benchmark, making the current context thread-local so each thread can draw into its own.
+// The variable is defined in multithreaded_scaling.cpp.
+
+#pragma once
+
+struct ImGuiContext;
+extern thread_local ImGuiContext* BenchmarkImGuiContext;
+#define GImGui BenchmarkImGuiContext
@@ -0,0 +1,55 @@
+// Records the renderer's profiling zones for a few frames of 1k toggles, and writes them to toggle_trace.json. See BENCHMARK.md.
+// It's built with IMGUI_TOGGLE_ENABLE_CHROME_TRACE, or nothing would be recorded.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include "benchmark_harness.h"
+
+#include <cstdio>
+#include <memory>
+
+static const int Count = 1000;
+static const int Columns = 64;
+static const int TracedFrames = 10;
+
+int main()
+{
+	begin_headless_context();
+
+	std::unique_ptr<bool[]> values(new bool[Count]());
+
+	run_frames(TracedFrames, ImGuiWindowFlags_NoDecoration,
+		[&](int frame)
+		{
+			// only trace frames once the caches are warm.
+			if (frame == WarmupFrames)
+			{
+				ImGui::ClearToggleChromeTrace();
+			}
+
+			// flip a few values each frame, so some toggles animate.
+			bool& flipped = values[(frame * 37) % Count];
+			flipped = !flipped;
+		},
+		[&](int)
+		{
+			for (int i = 0; i < Count; ++i)
+			{
+				if (i % Columns != 0)
+				{
+					ImGui::SameLine(0.0f, ImGui::GetStyle().ItemInnerSpacing.x);
+				}
+
+				ImGui::PushID(i);
+				ImGui::Toggle("##value", &values[i], ImGuiToggleFlags_Animated);
+				ImGui::PopID();
+			}
+		});
+
+	const bool written = ImGui::WriteToggleChromeTrace("toggle_trace.json");
+	printf(written ? "wrote toggle_trace.json\n" : "no trace written, build with -DIMGUI_TOGGLE_ENABLE_CHROME_TRACE\n");
+
+	end_headless_context();
+	return 0;
+}
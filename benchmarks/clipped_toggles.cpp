@@ -0,0 +1,51 @@
+// Draws a list of labelled toggles without a ImGuiListClipper, scrolled to the middle, so most toggles are clipped. See BENCHMARK.md.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include "benchmark_harness.h"
+
+#include <cstdio>
+#include <memory>
+
+static const int MeasuredFrames = 100;
+
+static void run_case(int count)
+{
+	begin_headless_context();
+
+	std::unique_ptr<bool[]> values(new bool[count]());
+
+	ImGuiToggleConfig config;
+	config.Flags = ImGuiToggleFlags_Animated | ImGuiToggleFlags_Bordered;
+
+	const FrameResults results = run_frames(MeasuredFrames, ImGuiWindowFlags_NoDecoration, [&](int)
+	{
+		ImGui::SetScrollY(ImGui::GetScrollMaxY() * 0.5f);
+
+		for (int i = 0; i < count; ++i)
+		{
+			ImGui::PushID(i);
+			ImGui::Toggle("Row Toggle", &values[i], config);
+			ImGui::PopID();
+		}
+	});
+
+	const double ns_per_frame = results.NsPerFrame();
+	printf("clipped,%d,%.0f,%.2f,%d\n", count, ns_per_frame, ns_per_frame / count, results.Vertices);
+
+	end_headless_context();
+}
+
+int main()
+{
+	printf("benchmark,rows,ns_per_frame,ns_per_row,vertices\n");
+
+	const int counts[] = { 1000, 10000, 50000 };
+	for (int count : counts)
+	{
+		run_case(count);
+	}
+
+	return 0;
+}
@@ -0,0 +1,62 @@
+// Draws 1k visible toggles with a config, then again with the same config compiled by ImGui::CompileToggleConfig(). See BENCHMARK.md.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include "benchmark_harness.h"
+
+#include <cstdio>
+#include <memory>
+
+static const int MeasuredFrames = 100;
+static const int ToggleCount = 1000;
+static const int ToggleColumns = 40;
+
+static void run_case(bool compiled)
+{
+	begin_headless_context();
+
+	std::unique_ptr<bool[]> values(new bool[ToggleCount]());
+
+	ImGuiToggleConfig config;
+	config.Flags = ImGuiToggleFlags_Animated | ImGuiToggleFlags_Bordered;
+	config.Size = ImVec2(40.0f, 20.0f);
+
+	ImGuiToggleCompiledConfig compiled_config;
+	ImGui::CompileToggleConfig(&compiled_config, config);
+
+	const FrameResults results = run_frames(MeasuredFrames, ImGuiWindowFlags_NoDecoration, [&](int)
+	{
+		for (int i = 0; i < ToggleCount; ++i)
+		{
+			if (i % ToggleColumns != 0)
+			{
+				ImGui::SameLine();
+			}
+
+			ImGui::PushID(i);
+			if (compiled)
+			{
+				ImGui::Toggle("##toggle", &values[i], compiled_config);
+			}
+			else
+			{
+				ImGui::Toggle("##toggle", &values[i], config);
+			}
+			ImGui::PopID();
+		}
+	});
+
+	const double ns_per_frame = results.NsPerFrame();
+	printf("%s,%d,%.0f,%.2f\n", compiled ? "compiled" : "config", ToggleCount, ns_per_frame, ns_per_frame / ToggleCount);
+
+	end_headless_context();
+}
+
+int main()
+{
+	printf("benchmark,toggles,ns_per_frame,ns_per_toggle\n");
+	run_case(false);
+	run_case(true);
+	return 0;
+}
@@ -0,0 +1,77 @@
+// Draws 300 visible labelled toggles with ImGui::Toggle(), then with ImGui::ToggleEx() and labels interned ahead of time. See BENCHMARK.md.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include "benchmark_harness.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+static const int MeasuredFrames = 100;
+static const int ToggleCount = 300;
+static const int ToggleColumns = 10;
+
+static void run_case(bool interned)
+{
+	begin_headless_context();
+
+	std::unique_ptr<bool[]> values(new bool[ToggleCount]());
+	std::vector<std::string> labels;
+	for (int i = 0; i < ToggleCount; ++i)
+	{
+		labels.push_back("Tenant Flag " + std::to_string(i) + "##flag");
+	}
+
+	ImGuiToggleConfig config;
+	config.Size = ImVec2(30.0f, 15.0f);
+
+	ImGuiToggleCompiledConfig compiled_config;
+	ImGui::CompileToggleConfig(&compiled_config, config);
+
+	// the interned labels and IDs are made once, as a generated UI would.
+	std::vector<const ImGuiToggleLabel*> interned_labels;
+	std::vector<ImGuiID> ids;
+	ImGui::NewFrame();
+	for (int i = 0; i < ToggleCount; ++i)
+	{
+		interned_labels.push_back(ImGui::InternToggleLabel(labels[i].c_str()));
+		ids.push_back(ImGui::GetID(labels[i].c_str()));
+	}
+	ImGui::EndFrame();
+
+	const FrameResults results = run_frames(MeasuredFrames, ImGuiWindowFlags_NoDecoration, [&](int)
+	{
+		for (int i = 0; i < ToggleCount; ++i)
+		{
+			if (i % ToggleColumns != 0)
+			{
+				ImGui::SameLine();
+			}
+
+			if (interned)
+			{
+				ImGui::ToggleEx(ids[i], *interned_labels[i], &values[i], compiled_config);
+			}
+			else
+			{
+				ImGui::Toggle(labels[i].c_str(), &values[i], compiled_config);
+			}
+		}
+	});
+
+	const double ns_per_frame = results.NsPerFrame();
+	printf("%s,%d,%.0f,%.2f\n", interned ? "interned" : "strings", ToggleCount, ns_per_frame, ns_per_frame / ToggleCount);
+
+	end_headless_context();
+}
+
+int main()
+{
+	printf("benchmark,toggles,ns_per_frame,ns_per_toggle\n");
+	run_case(false);
+	run_case(true);
+	return 0;
+}
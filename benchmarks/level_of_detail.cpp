@@ -0,0 +1,72 @@
+// Draws a compact status board of 2048 small toggles with ImGui::ToggleGrid(), once at each level of detail. See BENCHMARK.md.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include "benchmark_harness.h"
+
+#include <cstdio>
+#include <vector>
+
+static const int Count = 2048;
+static const int Columns = 64;
+static const ImVec2 ToggleSize = ImVec2(16.0f, 10.0f);
+static const int MeasuredFrames = 100;
+
+struct LodCase
+{
+	const char* Name;
+	float SimpleHeight;
+	float CoarseHeight;
+	float LedHeight;
+};
+
+static void run_case(const LodCase& lod_case, std::vector<ImU64>& bits)
+{
+	ImGuiToggleConfig config;
+	config.Flags = ImGuiToggleFlags_Bordered | ImGuiToggleFlags_Shadowed | ImGuiToggleFlags_A11y;
+	config.A11yStyle = ImGuiToggleA11yStyle_Dot;
+	config.Size = ToggleSize;
+	config.LodSimpleHeight = lod_case.SimpleHeight;
+	config.LodCoarseHeight = lod_case.CoarseHeight;
+	config.LodLedHeight = lod_case.LedHeight;
+
+	// every toggle fits in the window, so the vertex counts show the whole budget of the board.
+	const FrameResults results = run_frames(MeasuredFrames, ImGuiWindowFlags_NoDecoration, [&](int)
+	{
+		ImGui::ToggleGrid("##status", bits.data(), Count, Columns, config);
+	});
+
+	const double ns_per_frame = results.NsPerFrame();
+	printf("lod,%s,%d,%.0f,%.2f,%d,%d\n", lod_case.Name, Count, ns_per_frame, ns_per_frame / Count, results.Vertices, results.Indices);
+}
+
+int main()
+{
+	begin_headless_context();
+
+	std::vector<ImU64> bits((Count + 63) / 64, 0);
+	for (int i = 0; i < Count; i += 3)
+	{
+		bits[i / 64] |= (ImU64)1 << (i % 64);
+	}
+
+	// every threshold at or above a level is raised past the toggles' height of 10 pixels, so every toggle is drawn the same way.
+	const LodCase lod_cases[] =
+	{
+		{ "full", 0.0f, 0.0f, 0.0f },
+		{ "simple", 12.0f, 0.0f, 0.0f },
+		{ "coarse", 12.0f, 12.0f, 0.0f },
+		{ "led", 12.0f, 12.0f, 12.0f },
+	};
+
+	printf("benchmark,lod,count,ns_per_frame,ns_per_toggle,vertices,indices\n");
+
+	for (const LodCase& lod_case : lod_cases)
+	{
+		run_case(lod_case, bits);
+	}
+
+	end_headless_context();
+	return 0;
+}
@@ -0,0 +1,106 @@
+// Draws toggles in one ImGui context per thread, with every thread running at once, to check contexts on different threads don't contend. See BENCHMARK.md.
+// It's built with benchmark_imconfig.h, which makes the current context thread-local.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include "benchmark_harness.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+thread_local ImGuiContext* BenchmarkImGuiContext = nullptr;
+
+static const int Columns = 64;
+static const int CountPerThread = 10000;
+static const int MeasuredFrames = 200;
+
+struct ThreadResult
+{
+	double TotalNs = 0.0;
+};
+
+static void run_thread(std::atomic<int>* ready_count, int thread_count, ThreadResult* result)
+{
+	// every thread has its own context, and with it its own font atlas and toggle state.
+	begin_headless_context();
+
+	std::unique_ptr<bool[]> values(new bool[CountPerThread]());
+	for (int i = 0; i < CountPerThread; ++i)
+	{
+		values[i] = (i % 3) == 0;
+	}
+
+	// wait for every thread to be set up, so they are all measured running at once.
+	ready_count->fetch_add(1);
+	while (ready_count->load() < thread_count)
+	{
+		std::this_thread::yield();
+	}
+
+	result->TotalNs = run_frames(MeasuredFrames, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_HorizontalScrollbar, [&](int)
+	{
+		for (int i = 0; i < CountPerThread; ++i)
+		{
+			if (i % Columns != 0)
+			{
+				ImGui::SameLine();
+			}
+
+			ImGui::PushID(i);
+			ImGui::Toggle("##value", &values[i], ImGuiToggleFlags_Animated);
+			ImGui::PopID();
+		}
+	}).TotalNs;
+
+	end_headless_context();
+}
+
+int main()
+{
+	const int max_threads = std::max(1, (int)std::thread::hardware_concurrency());
+	double single_thread_toggles_per_second = 0.0;
+
+	printf("benchmark,threads,count_per_thread,ns_per_frame,ns_per_toggle,toggles_per_second,efficiency\n");
+
+	for (int thread_count = 1; thread_count <= max_threads; ++thread_count)
+	{
+		std::atomic<int> ready_count(0);
+		std::vector<ThreadResult> results(thread_count);
+		std::vector<std::thread> threads;
+
+		for (int i = 0; i < thread_count; ++i)
+		{
+			threads.emplace_back(run_thread, &ready_count, thread_count, &results[i]);
+		}
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		// the slowest thread decides how long a frame takes across all of them.
+		double slowest_ns = 0.0;
+		for (const ThreadResult& result : results)
+		{
+			slowest_ns = std::max(slowest_ns, result.TotalNs);
+		}
+
+		const double ns_per_frame = slowest_ns / MeasuredFrames;
+		const double toggles_per_second = (double)CountPerThread * thread_count / (ns_per_frame * 1e-9);
+		if (thread_count == 1)
+		{
+			single_thread_toggles_per_second = toggles_per_second;
+		}
+
+		const double efficiency = toggles_per_second / (single_thread_toggles_per_second * thread_count);
+		printf("threads,%d,%d,%.0f,%.2f,%.0f,%.3f\n", thread_count, CountPerThread, ns_per_frame, ns_per_frame / CountPerThread, toggles_per_second, efficiency);
+		fflush(stdout);
+	}
+
+	return 0;
+}
@@ -0,0 +1,78 @@
+// Draws 1k visible toggles over the bits of packed ImU64 words, through a shadow array of bools and with ImGui::ToggleBit(). See BENCHMARK.md.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include "benchmark_harness.h"
+
+#include <cstdio>
+#include <memory>
+
+static const int MeasuredFrames = 100;
+static const int ToggleCount = 1000;
+static const int ToggleColumns = 40;
+static const int WordCount = (ToggleCount + 63) / 64;
+
+static void run_case(bool in_place)
+{
+	begin_headless_context();
+
+	ImU64 words[WordCount] = {};
+	std::unique_ptr<bool[]> shadow(new bool[ToggleCount]());
+
+	ImGuiToggleConfig config;
+	config.Size = ImVec2(40.0f, 20.0f);
+
+	const FrameResults results = run_frames(MeasuredFrames, ImGuiWindowFlags_NoDecoration, [&](int)
+	{
+		// without ToggleBit(), the bits are copied out to bools and written back every frame.
+		if (!in_place)
+		{
+			for (int i = 0; i < ToggleCount; ++i)
+			{
+				shadow[i] = (words[i / 64] & ((ImU64)1 << (i % 64))) != 0;
+			}
+		}
+
+		for (int i = 0; i < ToggleCount; ++i)
+		{
+			if (i % ToggleColumns != 0)
+			{
+				ImGui::SameLine();
+			}
+
+			ImGui::PushID(i);
+			if (in_place)
+			{
+				ImGui::ToggleBit("##toggle", &words[i / 64], i % 64, config);
+			}
+			else
+			{
+				ImGui::Toggle("##toggle", &shadow[i], config);
+			}
+			ImGui::PopID();
+		}
+
+		if (!in_place)
+		{
+			for (int i = 0; i < ToggleCount; ++i)
+			{
+				const ImU64 mask = (ImU64)1 << (i % 64);
+				words[i / 64] = shadow[i] ? (words[i / 64] | mask) : (words[i / 64] & ~mask);
+			}
+		}
+	});
+
+	const double ns_per_frame = results.NsPerFrame();
+	printf("%s,%d,%.0f,%.2f\n", in_place ? "toggle_bit" : "shadow_bools", ToggleCount, ns_per_frame, ns_per_frame / ToggleCount);
+
+	end_headless_context();
+}
+
+int main()
+{
+	printf("benchmark,toggles,ns_per_frame,ns_per_toggle\n");
+	run_case(false);
+	run_case(true);
+	return 0;
+}
@@ -0,0 +1,79 @@
+// Compares blending resolved palettes one at a time with ImGui::BlendResolvedPalettes() against all at once with ImGui::BlendResolvedPalettesN(). See BENCHMARK.md.
+// Built once as usual, measuring the SSE2 or NEON path where the target has one, and once with IMGUI_TOGGLE_DISABLE_SIMD, measuring the plain C++ path.
+
+#include "imgui.h"
+#include "imgui_toggle_palette.h"
+
+#include "benchmark_harness.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static const int Counts[] = { 1, 16, 256, 4096, 65536 };
+static const int PalettesPerRun = 4 * 1024 * 1024;
+
+static ImGuiToggleResolvedPalette make_palette(ImU32 seed)
+{
+	ImGuiToggleResolvedPalette palette;
+	ImU32* colors = reinterpret_cast<ImU32*>(&palette);
+
+	for (size_t i = 0; i < sizeof(palette) / sizeof(ImU32); ++i)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		colors[i] = seed;
+	}
+
+	return palette;
+}
+
+int main()
+{
+	using clock = std::chrono::steady_clock;
+
+	// no context is needed, blending only touches the palettes given.
+	const ImGuiToggleResolvedPalette palette_off = make_palette(1);
+	const ImGuiToggleResolvedPalette palette_on = make_palette(2);
+
+	printf("benchmark,count,kernel,ns_per_palette,matches\n");
+
+	for (int count : Counts)
+	{
+		// spread the blend amounts over the whole animation, including both ends.
+		std::vector<float> blend_amounts(count);
+		for (int i = 0; i < count; ++i)
+		{
+			blend_amounts[i] = count > 1 ? (float)i / (float)(count - 1) : 0.5f;
+		}
+
+		std::vector<ImGuiToggleResolvedPalette> scalar_results(count);
+		std::vector<ImGuiToggleResolvedPalette> batch_results(count);
+		const int repeats = PalettesPerRun / count;
+
+		const clock::time_point scalar_start = clock::now();
+		for (int repeat = 0; repeat < repeats; ++repeat)
+		{
+			for (int i = 0; i < count; ++i)
+			{
+				ImGui::BlendResolvedPalettes(&scalar_results[i], palette_off, palette_on, blend_amounts[i]);
+			}
+		}
+		const double scalar_ns = elapsed_ns(scalar_start, clock::now());
+
+		const clock::time_point batch_start = clock::now();
+		for (int repeat = 0; repeat < repeats; ++repeat)
+		{
+			ImGui::BlendResolvedPalettesN(batch_results.data(), palette_off, palette_on, blend_amounts.data(), count);
+		}
+		const double batch_ns = elapsed_ns(batch_start, clock::now());
+
+		const bool matches = memcmp(scalar_results.data(), batch_results.data(), sizeof(ImGuiToggleResolvedPalette) * count) == 0;
+		const double palettes = (double)repeats * count;
+
+		printf("palette_blend,%d,one_at_a_time,%.3f,%s\n", count, scalar_ns / palettes, matches ? "yes" : "no");
+		printf("palette_blend,%d,all_at_once,%.3f,%s\n", count, batch_ns / palettes, matches ? "yes" : "no");
+	}
+
+	return 0;
+}
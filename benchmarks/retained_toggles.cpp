@@ -0,0 +1,79 @@
+// Draws toggles that never change value while nothing moves, while the window scrolls, and while the mouse sweeps across them. See BENCHMARK.md.
+// Built once as usual, and once with IMGUI_TOGGLE_DISABLE_RETAINED to compare against drawing every toggle as usual.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include "benchmark_harness.h"
+
+#include <cfloat>
+#include <cstdio>
+#include <memory>
+
+static const int Columns = 64;
+static const int MeasuredFrames = 100;
+
+enum Mode { Mode_Static, Mode_Scrolling, Mode_Hovering };
+static const char* const ModeNames[] = { "static", "scrolling", "hovering" };
+
+static void run_case(Mode mode, int count)
+{
+	begin_headless_context();
+	ImGuiIO& io = ImGui::GetIO();
+
+	std::unique_ptr<bool[]> values(new bool[count]());
+	for (int i = 0; i < count; i += 3)
+	{
+		values[i] = true;
+	}
+
+	ImGuiToggleConfig config;
+	config.Flags = ImGuiToggleFlags_Bordered | ImGuiToggleFlags_Shadowed;
+
+	const FrameResults results = run_frames(MeasuredFrames, ImGuiWindowFlags_NoDecoration,
+		[&](int frame)
+		{
+			io.MousePos = mode == Mode_Hovering
+				? ImVec2((float)((frame * 7) % (int)io.DisplaySize.x), (float)((frame * 3) % (int)io.DisplaySize.y))
+				: ImVec2(-FLT_MAX, -FLT_MAX);
+		},
+		[&](int frame)
+		{
+			if (mode == Mode_Scrolling)
+			{
+				ImGui::SetScrollY((float)(frame * 3));
+			}
+
+			for (int i = 0; i < count; ++i)
+			{
+				if (i % Columns != 0)
+				{
+					ImGui::SameLine(0.0f, ImGui::GetStyle().ItemInnerSpacing.x);
+				}
+
+				ImGui::PushID(i);
+				ImGui::Toggle("##value", &values[i], config);
+				ImGui::PopID();
+			}
+		});
+
+	const double ns_per_frame = results.NsPerFrame();
+	printf("retained,%s,%d,%.0f,%.2f,%d\n", ModeNames[mode], count, ns_per_frame, ns_per_frame / count, results.Vertices);
+
+	end_headless_context();
+}
+
+int main()
+{
+	printf("benchmark,mode,count,ns_per_frame,ns_per_toggle,vertices\n");
+
+	const int counts[] = { 1000, 10000, 100000 };
+	for (int count : counts)
+	{
+		run_case(Mode_Static, count);
+		run_case(Mode_Scrolling, count);
+		run_case(Mode_Hovering, count);
+	}
+
+	return 0;
+}
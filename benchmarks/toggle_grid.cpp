@@ -0,0 +1,69 @@
+// Compares drawing `count` toggles with one ImGui::Toggle() call each against a single ImGui::ToggleGrid() call. See BENCHMARK.md.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include "benchmark_harness.h"
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+static const int Columns = 64;
+static const int MeasuredFrames = 100;
+
+static void print_results(const char* path, int count, const FrameResults& results)
+{
+	const double ns_per_frame = results.NsPerFrame();
+	printf("grid,%s,%d,%.0f,%.2f,%d,%d\n", path, count, ns_per_frame, ns_per_frame / count, results.Vertices, results.Indices);
+}
+
+int main()
+{
+	printf("benchmark,path,count,ns_per_frame,ns_per_toggle,vertices,indices\n");
+
+	const int counts[] = { 1000, 10000, 100000 };
+	for (int count : counts)
+	{
+		begin_headless_context();
+
+		std::unique_ptr<bool[]> values(new bool[count]());
+		std::vector<ImU64> bits((count + 63) / 64, 0);
+
+		for (int i = 0; i < count; ++i)
+		{
+			values[i] = (i % 3) == 0;
+			if (values[i])
+			{
+				bits[i / 64] |= (ImU64)1 << (i % 64);
+			}
+		}
+
+		// both paths lay the toggles out in rows of 64 inside a window that scrolls, so most of them are clipped.
+		const ImGuiWindowFlags window_flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_HorizontalScrollbar;
+
+		print_results("toggle", count, run_frames(MeasuredFrames, window_flags, [&](int)
+		{
+			for (int i = 0; i < count; ++i)
+			{
+				if (i % Columns != 0)
+				{
+					ImGui::SameLine(0.0f, ImGui::GetStyle().ItemInnerSpacing.x);
+				}
+
+				ImGui::PushID(i);
+				ImGui::Toggle("##value", &values[i]);
+				ImGui::PopID();
+			}
+		}));
+
+		print_results("toggle_grid", count, run_frames(MeasuredFrames, window_flags, [&](int)
+		{
+			ImGui::ToggleGrid("##values", bits.data(), count, Columns);
+		}));
+
+		end_headless_context();
+	}
+
+	return 0;
+}
@@ -0,0 +1,83 @@
+// Draws a ImGui::ToggleList() of 1M rows with labels built on demand, unfiltered and then filtered. See BENCHMARK.md.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include "benchmark_harness.h"
+
+#include <cstdio>
+#include <memory>
+
+static const int MeasuredFrames = 100;
+static const int RowCount = 1000000;
+
+struct Rows
+{
+	std::unique_ptr<bool[]> Values;
+	int LabelRequests = 0;
+	char Label[32];
+};
+
+static const char* get_label(void* user_data, int index)
+{
+	Rows* rows = (Rows*)user_data;
+	rows->LabelRequests++;
+	snprintf(rows->Label, sizeof(rows->Label), "Flag %07d", index);
+	return rows->Label;
+}
+
+static bool get_value(void* user_data, int index)
+{
+	return ((Rows*)user_data)->Values[index];
+}
+
+static void set_value(void* user_data, int index, bool value)
+{
+	((Rows*)user_data)->Values[index] = value;
+}
+
+static void run_case(const char* filter)
+{
+	begin_headless_context();
+
+	Rows rows;
+	rows.Values.reset(new bool[RowCount]());
+
+	ImGuiToggleListSource source;
+	source.Count = RowCount;
+	source.GetLabel = get_label;
+	source.GetValue = get_value;
+	source.SetValue = set_value;
+	source.UserData = &rows;
+
+	int indexing_frames = 0;
+
+	const FrameResults results = run_frames(MeasuredFrames, ImGuiWindowFlags_NoDecoration,
+		[&](int frame)
+		{
+			// only count the labels asked for by the measured frames.
+			if (frame == WarmupFrames)
+			{
+				rows.LabelRequests = 0;
+			}
+		},
+		[&](int)
+		{
+			ImGui::ToggleList("##rows", source, filter, ImVec2(0.0f, -1.0f));
+			indexing_frames += ImGui::ToggleAnimationsPending() ? 1 : 0;
+		});
+
+	// the slowest frame counts the warmup too, as that's where the filter is indexed.
+	printf("%s,%d,%.0f,%.0f,%d,%d\n", filter != nullptr ? "filtered" : "unfiltered", RowCount, results.NsPerFrame(), results.SlowestNs,
+		indexing_frames, rows.LabelRequests / MeasuredFrames);
+
+	end_headless_context();
+}
+
+int main()
+{
+	printf("benchmark,rows,ns_per_frame,slowest_frame_ns,indexing_frames,labels_per_frame\n");
+	run_case(nullptr);
+	run_case("42");
+	return 0;
+}
@@ -0,0 +1,194 @@
+// Measures the cost of a toggle across the public API, for every overload, preset and combination of flags. See BENCHMARK.md.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+#include "imgui_toggle_presets.h"
+
+#include "benchmark_harness.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+static const int Columns = 64;
+static const int MeasuredToggles = 1000000;
+static const int MaxMeasuredFrames = 1000;
+static const int MinMeasuredFrames = 10;
+
+// at 60 frames a second, the default 100ms animation takes 6 frames. flipping more often keeps every toggle animating.
+static const int FlipIntervalFrames = 4;
+
+typedef void (*DrawToggleFn)(bool* v, const ImGuiToggleConfig& config);
+
+struct BenchmarkCase
+{
+	const char* Group;
+	std::string Name;
+	DrawToggleFn Draw;
+	ImGuiToggleConfig Config;
+};
+
+static void add_case(std::vector<BenchmarkCase>& cases, const char* group, const std::string& name, DrawToggleFn draw, const ImGuiToggleConfig& config)
+{
+	BenchmarkCase bench;
+	bench.Group = group;
+	bench.Name = name;
+	bench.Draw = draw;
+	bench.Config = config;
+	cases.push_back(bench);
+}
+
+static std::vector<BenchmarkCase> make_cases()
+{
+	std::vector<BenchmarkCase> cases;
+
+	// the overloads are given a config with animation on, the ones without animation parameters ignore it.
+	ImGuiToggleConfig animated;
+	animated.Flags = ImGuiToggleFlags_Animated;
+
+	add_case(cases, "checkbox", "checkbox", [](bool* v, const ImGuiToggleConfig&) { ImGui::Checkbox("##value", v); }, animated);
+
+	add_case(cases, "overload", "size", [](bool* v, const ImGuiToggleConfig&) { ImGui::Toggle("##value", v); }, animated);
+	add_case(cases, "overload", "flags", [](bool* v, const ImGuiToggleConfig& c) { ImGui::Toggle("##value", v, c.Flags); }, animated);
+	add_case(cases, "overload", "flags_duration", [](bool* v, const ImGuiToggleConfig& c) { ImGui::Toggle("##value", v, c.Flags, c.AnimationDuration); }, animated);
+	add_case(cases, "overload", "flags_rounding", [](bool* v, const ImGuiToggleConfig& c) { ImGui::Toggle("##value", v, c.Flags, c.FrameRounding, c.KnobRounding); }, animated);
+	add_case(cases, "overload", "flags_duration_rounding", [](bool* v, const ImGuiToggleConfig& c) { ImGui::Toggle("##value", v, c.Flags, c.AnimationDuration, c.FrameRounding, c.KnobRounding); }, animated);
+	add_case(cases, "overload", "config", [](bool* v, const ImGuiToggleConfig& c) { ImGui::Toggle("##value", v, c); }, animated);
+
+	const DrawToggleFn draw_config = [](bool* v, const ImGuiToggleConfig& c) { ImGui::Toggle("##value", v, c); };
+
+	add_case(cases, "preset", "default", draw_config, ImGuiTogglePresets::DefaultStyle());
+	add_case(cases, "preset", "rectangle", draw_config, ImGuiTogglePresets::RectangleStyle());
+	add_case(cases, "preset", "glowing", draw_config, ImGuiTogglePresets::GlowingStyle());
+	add_case(cases, "preset", "ios", draw_config, ImGuiTogglePresets::iOSStyle());
+	add_case(cases, "preset", "ios_light", draw_config, ImGuiTogglePresets::iOSStyle(1.0f, true));
+	add_case(cases, "preset", "material", draw_config, ImGuiTogglePresets::MaterialStyle());
+	add_case(cases, "preset", "minecraft", draw_config, ImGuiTogglePresets::MinecraftStyle());
+
+	struct NamedFlag { ImGuiToggleFlags Flag; const char* Name; };
+	const NamedFlag flags[] =
+	{
+		{ ImGuiToggleFlags_Animated, "animated" },
+		{ ImGuiToggleFlags_BorderedFrame, "bordered_frame" },
+		{ ImGuiToggleFlags_BorderedKnob, "bordered_knob" },
+		{ ImGuiToggleFlags_ShadowedFrame, "shadowed_frame" },
+		{ ImGuiToggleFlags_ShadowedKnob, "shadowed_knob" },
+		{ ImGuiToggleFlags_A11y, "a11y" },
+	};
+	const int flag_count = (int)(sizeof(flags) / sizeof(flags[0]));
+
+	for (int combination = 0; combination < (1 << flag_count); ++combination)
+	{
+		ImGuiToggleConfig config;
+		std::string name;
+
+		for (int i = 0; i < flag_count; ++i)
+		{
+			if ((combination & (1 << i)) != 0)
+			{
+				config.Flags |= flags[i].Flag;
+				name += name.empty() ? "" : "+";
+				name += flags[i].Name;
+			}
+		}
+
+		add_case(cases, "flags", name.empty() ? "none" : name, draw_config, config);
+	}
+
+	// the same combinations as in "flags", with the flags known at compile time.
+	const ImGuiToggleConfig fixed;
+	add_case(cases, "fixed", "none", [](bool* v, const ImGuiToggleConfig& c) { ImGui::Toggle<ImGuiToggleFlags_None>("##value", v, c); }, fixed);
+	add_case(cases, "fixed", "animated", [](bool* v, const ImGuiToggleConfig& c) { ImGui::Toggle<ImGuiToggleFlags_Animated>("##value", v, c); }, fixed);
+	add_case(cases, "fixed", "animated+bordered_frame+bordered_knob", [](bool* v, const ImGuiToggleConfig& c) { ImGui::Toggle<ImGuiToggleFlags_Animated | ImGuiToggleFlags_Bordered>("##value", v, c); }, fixed);
+	add_case(cases, "fixed", "animated+shadowed_frame+shadowed_knob", [](bool* v, const ImGuiToggleConfig& c) { ImGui::Toggle<ImGuiToggleFlags_Animated | ImGuiToggleFlags_Shadowed>("##value", v, c); }, fixed);
+	add_case(cases, "fixed", "animated+bordered_frame+bordered_knob+shadowed_frame+shadowed_knob+a11y", [](bool* v, const ImGuiToggleConfig& c) { ImGui::Toggle<ImGuiToggleFlags_All>("##value", v, c); }, fixed);
+
+	return cases;
+}
+
+// the cases are built inside each run's own context, as the presets that scale with the font size need one,
+// and the palettes they point to only live as long as it does.
+static int count_cases()
+{
+	begin_headless_context();
+	const int case_count = (int)make_cases().size();
+	end_headless_context();
+	return case_count;
+}
+
+static void run_case(int case_index, bool animating, int count)
+{
+	begin_headless_context();
+
+	const std::vector<BenchmarkCase> cases = make_cases();
+	const BenchmarkCase& bench = cases[case_index];
+
+	std::unique_ptr<bool[]> values(new bool[count]());
+	for (int i = 0; i < count; ++i)
+	{
+		values[i] = (i % 3) == 0;
+	}
+
+	// keep the total number of toggles measured roughly the same for every count.
+	const int measured_frames = std::min(MaxMeasuredFrames, std::max(MinMeasuredFrames, MeasuredToggles / count));
+
+	const FrameResults results = run_frames(measured_frames, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_HorizontalScrollbar,
+		[&](int frame)
+		{
+			if (animating && frame % FlipIntervalFrames == 0)
+			{
+				for (int i = 0; i < count; ++i)
+				{
+					values[i] = !values[i];
+				}
+			}
+		},
+		[&](int)
+		{
+			for (int i = 0; i < count; ++i)
+			{
+				if (i % Columns != 0)
+				{
+					ImGui::SameLine();
+				}
+
+				ImGui::PushID(i);
+				bench.Draw(&values[i], bench.Config);
+				ImGui::PopID();
+			}
+		});
+
+	const double ns_per_frame = results.NsPerFrame();
+	printf("%s,%s,%s,%d,%d,%.0f,%.2f,%d,%d,%.2f,%.0f\n",
+		bench.Group, bench.Name.c_str(), animating ? "animating" : "static", count, measured_frames,
+		ns_per_frame, ns_per_frame / count, results.Vertices, results.Indices,
+		(double)results.Allocations / measured_frames, (double)results.AllocatedBytes / measured_frames);
+	fflush(stdout);
+
+	end_headless_context();
+}
+
+int main(int argc, char** argv)
+{
+	const int max_count = argc > 1 ? atoi(argv[1]) : 100000;
+	use_counting_allocator();
+	const int case_count = count_cases();
+
+	printf("group,case,mode,count,frames,ns_per_frame,ns_per_toggle,vertices,indices,allocations_per_frame,bytes_per_frame\n");
+
+	for (int case_index = 0; case_index < case_count; ++case_index)
+	{
+		for (int animating = 0; animating < 2; ++animating)
+		{
+			for (int count = 1; count <= max_count; count *= 10)
+			{
+				run_case(case_index, animating != 0, count);
+			}
+		}
+	}
+
+	return 0;
+}
@@ -5,8 +5,11 @@
 #include "imgui_toggle.h"
 #include "imgui.h"
 
+#include "imgui_toggle_context.h"
+#include "imgui_toggle_events.h"
 #include "imgui_toggle_math.h"
 #include "imgui_toggle_palette.h"
+#include "imgui_toggle_profile.h"
 #include "imgui_toggle_renderer.h"
 
 
@@ -15,7 +18,8 @@ using namespace ImGuiToggleMath;
 
 namespace
 {
-    bool ToggleInternal(const char* label, bool* value, const ImGuiToggleConfig& config);
+    bool ToggleInternal(ImGuiToggleContext* context, const char* label, const ImGuiToggleBinding& binding, const ImGuiToggleConfig& config);
+    bool ToggleGridInternal(ImGuiToggleContext* context, const char* str_id, ImU64* bits, int count, int columns, const ImGuiToggleConfig& config);
 
     // sets the given config structure's values to the
     // default ones used by the `Toggle()` overloads.
@@ -26,32 +30,33 @@ namespace
         config.FrameRounding = FrameRoundingDefault;
         config.KnobRounding = KnobRoundingDefault;
     }
-
-    // thread-local data for the `Toggle()` functions to easily call `ToggleInternal()`.
-    static thread_local ImGuiToggleConfig _internalConfig;
 } // namespace
 
 bool ImGui::Toggle(const char* label, bool* v, const ImVec2& size /*= ImVec2()*/)
 {
-    ::SetToAliasDefaults(::_internalConfig);
-    ::_internalConfig.Size = size;
-    return ::ToggleInternal(label, v, ::_internalConfig);
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    ImGuiToggleConfig& config = context->AliasConfig;
+    ::SetToAliasDefaults(config);
+    config.Size = size;
+    return ::ToggleInternal(context, label, ImGuiToggleBinding::FromBool(v), config);
 }
 
 bool ImGui::Toggle(const char* label, bool* v, ImGuiToggleFlags flags, const ImVec2& size /*= ImVec2()*/)
 {
-    ::SetToAliasDefaults(::_internalConfig);
-    ::_internalConfig.Flags = flags;
-    ::_internalConfig.Size = size;
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    ImGuiToggleConfig& config = context->AliasConfig;
+    ::SetToAliasDefaults(config);
+    config.Flags = flags;
+    config.Size = size;
 
     // if the user is using any animation flags,
     // set the default animation duration.
     if ((flags & ImGuiToggleFlags_Animated) != 0)
     {
-        _internalConfig.AnimationDuration = AnimationDurationDefault;
+        config.AnimationDuration = AnimationDurationDefault;
     }
     
-    return ::ToggleInternal(label, v, ::_internalConfig);
+    return ::ToggleInternal(context, label, ImGuiToggleBinding::FromBool(v), config);
 }
 
 bool ImGui::Toggle(const char* label, bool* v, ImGuiToggleFlags flags, float animation_duration, const ImVec2& size /*= ImVec2()*/)
@@ -63,23 +68,27 @@ bool ImGui::Toggle(const char* label, bool* v, ImGuiToggleFlags flags, float ani
         flags = flags | (ImGuiToggleFlags_Animated);
     }
 
-    ::SetToAliasDefaults(::_internalConfig);
-    ::_internalConfig.Flags = flags;
-    ::_internalConfig.AnimationDuration = animation_duration;
-    ::_internalConfig.Size = size;
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    ImGuiToggleConfig& config = context->AliasConfig;
+    ::SetToAliasDefaults(config);
+    config.Flags = flags;
+    config.AnimationDuration = animation_duration;
+    config.Size = size;
 
-    return ::ToggleInternal(label, v, ::_internalConfig);
+    return ::ToggleInternal(context, label, ImGuiToggleBinding::FromBool(v), config);
 }
 
 bool ImGui::Toggle(const char* label, bool* v, ImGuiToggleFlags flags, float frame_rounding, float knob_rounding, const ImVec2& size /*= ImVec2()*/)
 {
-    ::SetToAliasDefaults(::_internalConfig);
-    ::_internalConfig.Flags = flags;
-    ::_internalConfig.FrameRounding = frame_rounding;
-    ::_internalConfig.KnobRounding = knob_rounding;
-    ::_internalConfig.Size = size;
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    ImGuiToggleConfig& config = context->AliasConfig;
+    ::SetToAliasDefaults(config);
+    config.Flags = flags;
+    config.FrameRounding = frame_rounding;
+    config.KnobRounding = knob_rounding;
+    config.Size = size;
 
-    return ::ToggleInternal(label, v, ::_internalConfig);
+    return ::ToggleInternal(context, label, ImGuiToggleBinding::FromBool(v), config);
 }
 
 bool ImGui::Toggle(const char* label, bool* v, ImGuiToggleFlags flags, float animation_duration, float frame_rounding, float knob_rounding, const ImVec2& size /*= ImVec2()*/)
@@ -91,26 +100,298 @@ bool ImGui::Toggle(const char* label, bool* v, ImGuiToggleFlags flags, float ani
         flags = flags | (ImGuiToggleFlags_Animated);
     }
 
-    ::_internalConfig.Flags = flags;
-    ::_internalConfig.AnimationDuration = animation_duration;
-    ::_internalConfig.FrameRounding = frame_rounding;
-    ::_internalConfig.KnobRounding = knob_rounding;
-    ::_internalConfig.Size = size;
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    ImGuiToggleConfig& config = context->AliasConfig;
+    config.Flags = flags;
+    config.AnimationDuration = animation_duration;
+    config.FrameRounding = frame_rounding;
+    config.KnobRounding = knob_rounding;
+    config.Size = size;
 
-    return ::ToggleInternal(label, v, ::_internalConfig);
+    return ::ToggleInternal(context, label, ImGuiToggleBinding::FromBool(v), config);
 }
 
 bool ImGui::Toggle(const char* label, bool* v, const ImGuiToggleConfig& config)
 {
-    return ::ToggleInternal(label, v, config);
+    return ::ToggleInternal(ImGui::GetToggleContext(), label, ImGuiToggleBinding::FromBool(v), config);
+}
+
+template<ImGuiToggleFlags Flags>
+bool ImGui::Toggle(const char* label, bool* v, const ImGuiToggleConfig& config)
+{
+    static_assert((Flags & ~ImGuiToggleFlags_All) == 0, "Toggle<Flags>() was given a value that isn't an ImGuiToggleFlags_ flag.");
+
+    ImGuiToggleRenderer& renderer = ImGui::GetToggleContext()->Renderer;
+    renderer.SetConfig(label, ImGuiToggleBinding::FromBool(v), config);
+    renderer.SetFlags(Flags);
+    return renderer.Render<Flags>();
+}
+
+// instantiate every combination of flags, as callers only see the declaration.
+#define IMGUI_TOGGLE_INSTANTIATE_FIXED_FLAGS(flags) template IMGUI_API bool ImGui::Toggle<(flags)>(const char* label, bool* v, const ImGuiToggleConfig& config);
+IMGUI_TOGGLE_FOR_EACH_FLAGS(IMGUI_TOGGLE_INSTANTIATE_FIXED_FLAGS)
+#undef IMGUI_TOGGLE_INSTANTIATE_FIXED_FLAGS
+
+bool ImGui::ToggleBit(const char* label, ImU32* word, int bit, const ImVec2& size /*= ImVec2()*/)
+{
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    ImGuiToggleConfig& config = context->AliasConfig;
+    ::SetToAliasDefaults(config);
+    config.Size = size;
+    return ImGui::ToggleBit(label, word, bit, config);
+}
+
+bool ImGui::ToggleBit(const char* label, ImU32* word, int bit, const ImGuiToggleConfig& config)
+{
+    IM_ASSERT_USER_ERROR(word != nullptr, "ToggleBit() needs a word to toggle a bit of.");
+    IM_ASSERT_USER_ERROR(bit >= 0 && bit < 32, "ToggleBit() was given a bit outside of its 32 bit word.");
+    return ::ToggleInternal(ImGui::GetToggleContext(), label, ImGuiToggleBinding::FromBit(word, bit), config);
+}
+
+bool ImGui::ToggleBit(const char* label, ImU64* word, int bit, const ImVec2& size /*= ImVec2()*/)
+{
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    ImGuiToggleConfig& config = context->AliasConfig;
+    ::SetToAliasDefaults(config);
+    config.Size = size;
+    return ImGui::ToggleBit(label, word, bit, config);
+}
+
+bool ImGui::ToggleBit(const char* label, ImU64* word, int bit, const ImGuiToggleConfig& config)
+{
+    IM_ASSERT_USER_ERROR(word != nullptr, "ToggleBit() needs a word to toggle a bit of.");
+    IM_ASSERT_USER_ERROR(bit >= 0 && bit < 64, "ToggleBit() was given a bit outside of its 64 bit word.");
+    return ::ToggleInternal(ImGui::GetToggleContext(), label, ImGuiToggleBinding::FromBit(word, bit), config);
+}
+
+bool ImGui::Toggle(const char* label, ImGuiToggleGetter getter, ImGuiToggleSetter setter, void* user_data, const ImVec2& size /*= ImVec2()*/)
+{
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    ImGuiToggleConfig& config = context->AliasConfig;
+    ::SetToAliasDefaults(config);
+    config.Size = size;
+    return ImGui::Toggle(label, getter, setter, user_data, config);
+}
+
+bool ImGui::Toggle(const char* label, ImGuiToggleGetter getter, ImGuiToggleSetter setter, void* user_data, const ImGuiToggleConfig& config)
+{
+    IM_ASSERT_USER_ERROR(getter != nullptr && setter != nullptr, "Toggle() needs both a getter and a setter.");
+    return ::ToggleInternal(ImGui::GetToggleContext(), label, ImGuiToggleBinding::FromAccessors(getter, setter, user_data), config);
+}
+
+bool ImGui::Toggle(const char* label, std::atomic<bool>* v, const ImVec2& size /*= ImVec2()*/)
+{
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    ImGuiToggleConfig& config = context->AliasConfig;
+    ::SetToAliasDefaults(config);
+    config.Size = size;
+    return ::ToggleInternal(context, label, ImGuiToggleBinding::FromAtomic(v), config);
+}
+
+bool ImGui::Toggle(const char* label, std::atomic<bool>* v, const ImGuiToggleConfig& config)
+{
+    return ::ToggleInternal(ImGui::GetToggleContext(), label, ImGuiToggleBinding::FromAtomic(v), config);
+}
+
+const ImGuiToggleLabel* ImGui::InternToggleLabel(const char* label)
+{
+    IM_ASSERT_USER_ERROR(label != nullptr, "InternToggleLabel() needs a label to intern.");
+    return ImGui::GetToggleContext()->InternedLabels.Intern(label);
+}
+
+bool ImGui::ToggleEx(ImGuiID id, const ImGuiToggleLabel& label, bool* v, const ImGuiToggleConfig& config)
+{
+    IM_ASSERT_USER_ERROR(id != 0, "ToggleEx() needs a non-zero ID.");
+    ImGuiToggleRenderer& renderer = ImGui::GetToggleContext()->Renderer;
+    renderer.SetConfig(label.Text, ImGuiToggleBinding::FromBool(v), config);
+    renderer.SetInternedLabel(id, label);
+    return renderer.Render();
+}
+
+bool ImGui::ToggleEx(ImGuiID id, const ImGuiToggleLabel& label, bool* v, const ImGuiToggleCompiledConfig& config)
+{
+    IM_ASSERT_USER_ERROR(id != 0, "ToggleEx() needs a non-zero ID.");
+    ImGuiToggleRenderer& renderer = ImGui::GetToggleContext()->Renderer;
+    renderer.SetCompiledConfig(label.Text, ImGuiToggleBinding::FromBool(v), config);
+    renderer.SetInternedLabel(id, label);
+    return renderer.Render();
+}
+
+void ImGui::CompileToggleConfig(ImGuiToggleCompiledConfig* compiled, const ImGuiToggleConfig& config)
+{
+    IM_ASSERT_USER_ERROR(compiled != nullptr, "CompileToggleConfig() needs a compiled config to fill out.");
+    ImGuiToggleRenderer::CompileConfig(compiled, config, config.Flags);
+}
+
+bool ImGui::Toggle(const char* label, bool* v, const ImGuiToggleCompiledConfig& config)
+{
+    ImGuiToggleRenderer& renderer = ImGui::GetToggleContext()->Renderer;
+    renderer.SetCompiledConfig(label, ImGuiToggleBinding::FromBool(v), config);
+    return renderer.Render();
+}
+
+bool ImGui::ToggleGrid(const char* str_id, ImU64* bits, int count, int columns, const ImVec2& size /*= ImVec2()*/)
+{
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    ImGuiToggleConfig& config = context->AliasConfig;
+    ::SetToAliasDefaults(config);
+    config.Size = size;
+    return ::ToggleGridInternal(context, str_id, bits, count, columns, config);
+}
+
+bool ImGui::ToggleGrid(const char* str_id, ImU64* bits, int count, int columns, const ImGuiToggleConfig& config)
+{
+    return ::ToggleGridInternal(ImGui::GetToggleContext(), str_id, bits, count, columns, config);
+}
+
+bool ImGui::ToggleList(const char* str_id, const ImGuiToggleListSource& source, const char* filter /*= nullptr*/, const ImVec2& size /*= ImVec2()*/)
+{
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    ImGuiToggleConfig& config = context->AliasConfig;
+    ::SetToAliasDefaults(config);
+    config.Size = ImVec2();
+    return ImGui::ToggleList(str_id, source, filter, size, config);
+}
+
+bool ImGui::ToggleList(const char* str_id, const ImGuiToggleListSource& source, const char* filter, const ImVec2& size, const ImGuiToggleConfig& config)
+{
+    IMGUI_TOGGLE_PROFILE_SCOPE("ImGui::ToggleList");
+    IM_ASSERT_USER_ERROR(source.Count >= 0, "Toggle list count specified was negative.");
+    IM_ASSERT_USER_ERROR(source.GetLabel != nullptr && source.GetValue != nullptr && source.SetValue != nullptr, "Toggle list source needs a label getter, a value getter and a value setter.");
+
+    if (!ImGui::BeginChild(str_id, size))
+    {
+        ImGui::EndChild();
+        return false;
+    }
+
+    ImGuiContext& g = *GImGui;
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+
+    // without a filter, rows are the source's entries as they are, and only visible rows touch their labels.
+    const ImVector<int>* matches = nullptr;
+    int row_count = source.Count;
+    if (filter != nullptr && filter[0] != '\0')
+    {
+        const ImGuiToggleListIndex& index = context->Lists.Update(ImGui::GetCurrentWindow()->ID, source, filter, g.FrameCount);
+        matches = &index.Matches;
+        row_count = index.Matches.Size;
+    }
+
+    // every row is as tall as a toggle with a single line label, so the clipper can skip rows without measuring them.
+    const ImGuiStyle& style = g.Style;
+    const float toggle_height = config.Size.y > 0.0f ? config.Size.y : ImGui::GetFrameHeight();
+    const float row_height = ImMax(toggle_height, g.FontSize) + style.FramePadding.y * 2.0f + style.ItemSpacing.y;
+
+    // the config is compiled once for every row drawn.
+    ImGuiToggleCompiledConfig compiled_config;
+    ImGui::CompileToggleConfig(&compiled_config, config);
+
+    bool pressed = false;
+    ImGuiListClipper clipper;
+    clipper.Begin(row_count, row_height);
+    while (clipper.Step())
+    {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+        {
+            const int index = matches != nullptr ? (*matches)[row] : row;
+            bool value = source.GetValue(source.UserData, index);
+
+            ImGui::PushID(index);
+            if (ImGui::Toggle(source.GetLabel(source.UserData, index), &value, compiled_config))
+            {
+                source.SetValue(source.UserData, index, value);
+                pressed = true;
+            }
+            ImGui::PopID();
+        }
+    }
+
+    ImGui::EndChild();
+    return pressed;
+}
+
+void ImGui::BeginToggleBatch()
+{
+    ImGui::GetToggleContext()->Batch.Begin(ImGui::GetWindowDrawList());
+}
+
+void ImGui::EndToggleBatch()
+{
+    IMGUI_TOGGLE_PROFILE_SCOPE("ImGui::EndToggleBatch");
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    IM_ASSERT_USER_ERROR(context->Batch.DrawList == ImGui::GetWindowDrawList(), "EndToggleBatch() must be called in the same window as BeginToggleBatch().");
+    IMGUI_TOGGLE_STATS_DRAW_SCOPE(context->Stats.Current, context->Batch.DrawList);
+    context->Batch.End(&context->MeshCache, context->JobDispatcher, context->JobDispatcherUserData);
+}
+
+void ImGui::SetToggleJobDispatcher(ImGuiToggleJobDispatcher dispatcher, void* user_data /*= nullptr*/)
+{
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    context->JobDispatcher = dispatcher;
+    context->JobDispatcherUserData = user_data;
+}
+
+void ImGui::AddToggleSpritesToFontAtlas(ImFontAtlas* atlas /*= nullptr*/)
+{
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    context->MeshCache.Sprites = nullptr;
+    context->MeshCache.Clear();
+    context->Retained.Clear();
+    context->Sprites.AddRects(atlas != nullptr ? atlas : ImGui::GetIO().Fonts);
+}
+
+bool ImGui::BakeToggleSprites()
+{
+    ImGuiToggleContext* context = ImGui::GetToggleContext();
+    if (!context->Sprites.Bake())
+    {
+        return false;
+    }
+
+    // the shapes already in the caches were tessellated, so start over with sprites.
+    context->MeshCache.Clear();
+    context->MeshCache.Sprites = &context->Sprites;
+    context->Retained.Clear();
+    return true;
+}
+
+bool ImGui::ToggleAnimationsPending()
+{
+    return ImGui::ToggleNextWakeTime() >= 0.0;
+}
+
+double ImGui::ToggleNextWakeTime()
+{
+    // don't create the toggle state just to find out nothing is animating.
+    const ImGuiToggleContext* toggle_context = ImGui::FindToggleContext();
+    if (toggle_context == nullptr)
+    {
+        return -1.0;
+    }
+
+    // a list still finding matches for its filter needs the next frame as soon as possible.
+    if (toggle_context->Lists.IsIndexing(ImGui::GetFrameCount()))
+    {
+        return ImGui::GetTime();
+    }
+
+    return toggle_context->Animations.GetEndTime(ImGui::GetTime());
 }
 
 namespace
 {
-    bool ToggleInternal(const char* label, bool* v, const ImGuiToggleConfig& config)
+    bool ToggleInternal(ImGuiToggleContext* context, const char* label, const ImGuiToggleBinding& binding, const ImGuiToggleConfig& config)
     {
-        static thread_local ImGuiToggleRenderer renderer;
-        renderer.SetConfig(label, v, config);
+        ImGuiToggleRenderer& renderer = context->Renderer;
+        renderer.SetConfig(label, binding, config);
         return renderer.Render();
     }
+
+    bool ToggleGridInternal(ImGuiToggleContext* context, const char* str_id, ImU64* bits, int count, int columns, const ImGuiToggleConfig& config)
+    {
+        ImGuiToggleRenderer& renderer = context->Renderer;
+        renderer.SetConfig(str_id, ImGuiToggleBinding(), config);
+        return renderer.RenderGrid(bits, count, columns);
+    }
 }
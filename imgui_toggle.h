@@ -5,12 +5,24 @@
 
 // Type forward declarations, definitions below in this file.
 struct ImGuiToggleConfig;                   // Configuration data to fully customize a toggle.
+struct ImGuiToggleCompiledConfig;           // A toggle config validated once, ahead of drawing with it.
 struct ImGuiToggleStateConfig;              // The data describing how to draw a toggle in a given state.
 struct ImGuiTogglePalette;                  // Color data to adjust how a toggle is drawn.
+struct ImGuiToggleStats;                    // Counters of what toggles cost in a frame.
+struct ImGuiToggleListSource;               // Where the rows of a toggle list come from.
+struct ImGuiToggleLabel;                    // A label interned ahead of drawing with it.
 
 typedef int ImGuiToggleFlags;               // -> enum ImGuiToggleFlags_        // Flags: for Toggle() modes
 typedef int ImGuiToggleA11yStyle;            // -> enum ImGuiToggleA11yStyle_   // Describes how to draw A11y labels.
 
+// Callbacks for reading and writing a toggle's value wherever it's stored. See ImGui::Toggle().
+typedef bool (*ImGuiToggleGetter)(void* user_data);
+typedef void (*ImGuiToggleSetter)(void* user_data, bool value);
+
+// Callbacks for filling toggle batches on other threads. See ImGui::SetToggleJobDispatcher().
+typedef void (*ImGuiToggleJobFunction)(void* job_data, int job_index);
+typedef void (*ImGuiToggleJobDispatcher)(ImGuiToggleJobFunction job, void* job_data, int job_count, void* user_data);
+
 namespace ImGui
 {
     // Widgets: Toggle Switches
@@ -32,6 +44,111 @@ namespace ImGui
     IMGUI_API bool Toggle(const char* label, bool* v, ImGuiToggleFlags flags, float animation_duration, float frame_rounding, float knob_rounding, const ImVec2& size = ImVec2());
     IMGUI_API bool Toggle(const char* label, bool* v, const ImGuiToggleConfig& config);
 
+    // Widgets: Toggle Switches with Fixed Flags
+    // - Draws with `Flags` in place of `config.Flags`, which is ignored. As the flags are known at compile time, the drawing code for features not in `Flags` is compiled out.
+    // - Every combination of ImGuiToggleFlags_ values is instantiated in imgui_toggle.cpp, so a `Flags` with any other bits set fails to link.
+    // - e.g. `ImGui::Toggle<ImGuiToggleFlags_Animated | ImGuiToggleFlags_Bordered>("Label", &value, config);`
+    template<ImGuiToggleFlags Flags> IMGUI_API bool Toggle(const char* label, bool* v, const ImGuiToggleConfig& config);
+
+    // Widgets: Toggle Switches over Bits and Accessors
+    // - ToggleBit() toggles a single bit of a packed word in place, such as a set of feature flags, without copying it into a bool and back.
+    // - bit: The bit to toggle, [0, 32) for ImU32 words and [0, 64) for ImU64 words.
+    // - The overloads taking a getter and setter read the value once when the toggle is drawn, and only write it when the toggle is pressed.
+    IMGUI_API bool ToggleBit(const char* label, ImU32* word, int bit, const ImVec2& size = ImVec2());
+    IMGUI_API bool ToggleBit(const char* label, ImU32* word, int bit, const ImGuiToggleConfig& config);
+    IMGUI_API bool ToggleBit(const char* label, ImU64* word, int bit, const ImVec2& size = ImVec2());
+    IMGUI_API bool ToggleBit(const char* label, ImU64* word, int bit, const ImGuiToggleConfig& config);
+    IMGUI_API bool Toggle(const char* label, ImGuiToggleGetter getter, ImGuiToggleSetter setter, void* user_data, const ImVec2& size = ImVec2());
+    IMGUI_API bool Toggle(const char* label, ImGuiToggleGetter getter, ImGuiToggleSetter setter, void* user_data, const ImGuiToggleConfig& config);
+
+    // Widgets: Toggle Switches with Interned Labels
+    // - InternToggleLabel() copies a label into the current context once, and finds where its visible text ends. Interning the same text again returns the same label.
+    //   Interned labels live until the context is destroyed, so intern labels that are drawn again and again, not ones built each frame.
+    // - ToggleEx() draws a toggle with an interned label and an ID known ahead of time, so no strings are hashed or scanned as it's drawn.
+    //   The ID is used as is, rather than combined with the ID stack, e.g. one made once with `ImGui::GetID()`. The label is measured once for each font and size it's drawn in.
+    IMGUI_API const ImGuiToggleLabel* InternToggleLabel(const char* label);
+    IMGUI_API bool ToggleEx(ImGuiID id, const ImGuiToggleLabel& label, bool* v, const ImGuiToggleConfig& config);
+    IMGUI_API bool ToggleEx(ImGuiID id, const ImGuiToggleLabel& label, bool* v, const ImGuiToggleCompiledConfig& config);
+
+    // Widgets: Toggle Switches with Compiled Configs
+    // - CompileToggleConfig() validates and normalizes a config once, and works out what drawing with it needs. Compile it again after changing the config.
+    // - Toggles drawn with a compiled config only reference it: it isn't copied or validated again on each call.
+    IMGUI_API void CompileToggleConfig(ImGuiToggleCompiledConfig* compiled, const ImGuiToggleConfig& config);
+    IMGUI_API bool Toggle(const char* label, bool* v, const ImGuiToggleCompiledConfig& config);
+
+    // Widgets: Toggle Grids
+    // - Draws `count` toggles backed by a bitset, laid out left to right in rows of `columns` toggles.
+    // - The whole grid is a single item: the config and palettes are resolved once, and the toggle under the mouse is found by division.
+    // - Only rows inside the window's clipping rectangle are drawn, so very large grids only pay for what is visible.
+    // - bits: An array of at least (count + 63) / 64 words. Toggle `n` is stored in bit (n % 64) of word (n / 64).
+    // - size: The size of each toggle in the grid, as with `Toggle()`. Toggles are separated by `ImGuiStyle::ItemInnerSpacing`.
+    // - Returns true if any toggle in the grid was pressed.
+    IMGUI_API bool ToggleGrid(const char* str_id, ImU64* bits, int count, int columns, const ImVec2& size = ImVec2());
+    IMGUI_API bool ToggleGrid(const char* str_id, ImU64* bits, int count, int columns, const ImGuiToggleConfig& config);
+
+    // Widgets: Toggle Lists
+    // - Draws a scrolling list of `source.Count` labelled toggles in a child window, asking `source` for the label and value of each visible row as it's drawn.
+    // - Every row is the same height, worked out from the config, so rows outside the window are skipped without touching their labels. Labels should be a single line.
+    // - filter: Only shows rows whose label contains this text, ignoring case. Matches are found a slice of rows at a time over several frames,
+    //   and rows added to the end of the list are checked without starting over. While matches are still being found, ToggleAnimationsPending() returns true.
+    // - size: The size of the child window, as with `ImGui::BeginChild()`.
+    // - Returns true if any toggle in the list was pressed.
+    IMGUI_API bool ToggleList(const char* str_id, const ImGuiToggleListSource& source, const char* filter = nullptr, const ImVec2& size = ImVec2());
+    IMGUI_API bool ToggleList(const char* str_id, const ImGuiToggleListSource& source, const char* filter, const ImVec2& size, const ImGuiToggleConfig& config);
+
+    // Toggle Batches
+    // - Toggles drawn into the current window between BeginToggleBatch() and EndToggleBatch() have their shapes recorded, and EndToggleBatch() draws them all at once.
+    // - Layout and input are unchanged: each toggle still returns whether it was pressed when it is called.
+    // - Toggles drawn into other windows, and toggles with ImGuiToggleFlags_A11y, are drawn immediately as usual. Labels are always drawn immediately.
+    // - Batched toggles are drawn over anything else drawn into the window between the two calls, so avoid overlapping them with other items.
+    // - Both calls must be made in the same window, and batches can't be nested.
+    IMGUI_API void BeginToggleBatch();
+    IMGUI_API void EndToggleBatch();
+
+    // Toggle Batch Jobs
+    // - When EndToggleBatch() has many toggles to draw, the vertices can be written on other threads by a job dispatcher set for the current context.
+    // - The dispatcher must call `job(job_data, i)` once for every `i` in [0, job_count), on any threads, and only return once every job has finished.
+    // - Jobs only write vertices and indices into space already reserved in the window's draw list, and touch no other ImGui state.
+    // - Pass null to write everything on the calling thread, which is the default.
+    IMGUI_API void SetToggleJobDispatcher(ImGuiToggleJobDispatcher dispatcher, void* user_data = nullptr);
+
+    // Toggle Sprites
+    // - Bakes the round shapes toggles are drawn with into a font atlas, so each toggle draws as a handful of textured quads instead of tessellated, anti-aliased shapes.
+    // - Call AddToggleSpritesToFontAtlas() before the atlas is built, and BakeToggleSprites() after it is built and before its texture is uploaded,
+    //   e.g. right after `io.Fonts->GetTexDataAsRGBA32()`. The current context draws with the sprites once they are baked. If the atlas is cleared, add and bake them again.
+    // - Shadows are drawn from pre-blurred sprites, fading out smoothly over their thickness, rather than as thick strokes.
+    // - Shapes are scaled from the nearest size baked, so edges may be a little softer or sharper, and border thicknesses are approximated.
+    // - atlas: The atlas to bake into, or null for the current context's `io.Fonts`. Only toggles drawn while that atlas's texture is bound use the sprites.
+    // - Requires a Dear ImGui version before 1.92, as later versions move custom rects as the atlas grows. BakeToggleSprites() returns false if nothing was baked.
+    IMGUI_API void AddToggleSpritesToFontAtlas(ImFontAtlas* atlas = nullptr);
+    IMGUI_API bool BakeToggleSprites();
+
+    // Toggle Animation State
+    // - For applications that only render when there is input, these report when toggles need more frames to finish animating.
+    // - Call them after the frame's toggles have been drawn: an animation starts on the frame its toggle is drawn with a new value.
+    // - ToggleAnimationsPending(): Returns true if any toggle in the current context is still animating, or a toggle list is still finding matches for its filter.
+    // - ToggleNextWakeTime(): Returns the time, as in `ImGui::GetTime()`, that the last toggle animation finishes, or -1.0 if none are running.
+    //   While a toggle list is still finding matches for its filter, it returns the current time, as the next frame is needed right away.
+    //   Rendering one more frame at or after that time draws every toggle at rest.
+    IMGUI_API bool ToggleAnimationsPending();
+    IMGUI_API double ToggleNextWakeTime();
+
+    // Toggle Stats
+    // - Each context counts what its toggles cost every frame: how many were drawn or clipped, the vertices they emitted, and the work behind them.
+    // - GetToggleStats(): Returns the counts for the last full frame of the current context, or null if no toggle has been drawn in it yet.
+    // - ShowToggleStatsWindow(): Shows the counts, with graphs of their recent history.
+    // - Counting is off unless IMGUI_TOGGLE_ENABLE_STATS is defined, in imconfig.h so every source file sees it. Otherwise it compiles out entirely, and GetToggleStats() always returns null.
+    IMGUI_API const ImGuiToggleStats* GetToggleStats();
+    IMGUI_API void ShowToggleStatsWindow(bool* p_open = nullptr);
+
+    // Toggle Profiling
+    // - The renderer marks its hot path with IMGUI_TOGGLE_PROFILE_SCOPE(name), which expands to nothing unless defined. See imgui_toggle_profile.h to map it to your profiler.
+    // - With IMGUI_TOGGLE_ENABLE_CHROME_TRACE defined, zones are recorded by a reference backend, separately for each thread, to be viewed in chrome://tracing or Perfetto.
+    // - WriteToggleChromeTrace(): Writes the zones recorded on the calling thread to a chrome trace JSON file, and forgets them once written. Returns false, keeping them, if the file couldn't be opened or written.
+    // - ClearToggleChromeTrace(): Forgets the zones recorded on the calling thread, e.g. to only trace the frames after startup.
+    IMGUI_API bool WriteToggleChromeTrace(const char* filename);
+    IMGUI_API void ClearToggleChromeTrace();
+
 } // namespace ImGui
 
 
@@ -50,6 +167,7 @@ enum ImGuiToggleFlags_
     ImGuiToggleFlags_Bordered               = ImGuiToggleFlags_BorderedFrame | ImGuiToggleFlags_BorderedKnob, // Shorthand for bordered frame and knob.
     ImGuiToggleFlags_Shadowed               = ImGuiToggleFlags_ShadowedFrame | ImGuiToggleFlags_ShadowedKnob, // Shorthand for shadowed frame and knob.
     ImGuiToggleFlags_Default                = ImGuiToggleFlags_None, // The default flags used when no ImGuiToggleFlags_ are specified.
+    ImGuiToggleFlags_All                    = ImGuiToggleFlags_Animated | ImGuiToggleFlags_Bordered | ImGuiToggleFlags_Shadowed | ImGuiToggleFlags_A11y, // Every flag, for validating flags.
 };
 
 // ImGuiToggleA11yStyle: Styles to draw A11y labels.
@@ -121,6 +239,9 @@ namespace ImGuiToggleConstants
     // The default thickness for shadows drawn under the toggle frame and knob.
     constexpr float ShadowThicknessDefault = 2.0f;
 
+    // Level of detail thresholds are disabled with a height of 0.
+    constexpr float LodHeightDisabled = 0.0f;
+
     // The default a11y string used when the toggle is on.
     const char* const LabelA11yOnDefault = "1";
 
@@ -184,9 +305,67 @@ struct ImGuiToggleConfig
     // If `Size.y` is zero, the toggle height will be set by `ImGui::GetFrameHeight()`.
     ImVec2 Size = ImVec2(0.0f, 0.0f);
 
+    // Level of detail: toggles shorter than these heights, in pixels, are drawn with less detail, for small or dense toggles.
+    // Each level also applies the ones above it. A height of 0 disables that level, which is the default.
+    // Below `LodSimpleHeight`, shadows, borders, and A11y glyphs aren't drawn.
+    float LodSimpleHeight = ImGuiToggleConstants::LodHeightDisabled;
+
+    // Below `LodCoarseHeight`, round knobs are drawn with half as many segments.
+    float LodCoarseHeight = ImGuiToggleConstants::LodHeightDisabled;
+
+    // Below `LodLedHeight`, the toggle is drawn as an "LED": a square frame and a square knob, two quads without anti-aliasing.
+    float LodLedHeight = ImGuiToggleConstants::LodHeightDisabled;
+
     // Specific configuration data to use when the knob is in the on state.
     ImGuiToggleStateConfig On;
 
     // Specific configuration data to use when the knob is in the off state.
     ImGuiToggleStateConfig Off;
 };
+
+// ImGuiToggleListSource: Where the rows of a toggle list come from. See ImGui::ToggleList().
+//   Labels are only read while drawing or filtering the list, so they can be built on demand into a buffer that lives until the next call.
+struct ImGuiToggleListSource
+{
+    int Count = 0;                                                      // How many rows the list has.
+    const char* (*GetLabel)(void* user_data, int index) = nullptr;      // The label of row `index`.
+    bool (*GetValue)(void* user_data, int index) = nullptr;             // The value of row `index`.
+    void (*SetValue)(void* user_data, int index, bool value) = nullptr; // Sets the value of row `index`, when its toggle is pressed.
+    void* UserData = nullptr;
+};
+
+// ImGuiToggleLabel: A label interned into a context with ImGui::InternToggleLabel(), along with what drawing it needs.
+struct ImGuiToggleLabel
+{
+    const char* Text = nullptr;             // The label's text, owned by the context.
+    int RenderedLength = 0;                 // The length of the label's visible text, before any "##".
+    ImGuiID Hash = 0;                       // The hash of the label's text, which it's interned by.
+
+    // The size of the label's visible text, measured the first time it's drawn, and again whenever it's drawn in another font or size.
+    mutable ImVec2 Size = ImVec2(0.0f, 0.0f);
+    mutable ImFont* SizeFont = nullptr;
+    mutable float SizeFontSize = 0.0f;
+};
+
+// ImGuiToggleCompiledConfig: A config validated and normalized once, with what drawing it needs worked out ahead of time. See ImGui::CompileToggleConfig().
+//   Palettes and labels in the config are still referenced rather than copied, so they must outlive the compiled config.
+struct ImGuiToggleCompiledConfig
+{
+    ImGuiToggleConfig Config;               // The validated config.
+    bool IsAnimated = false;                // Config.Flags has ImGuiToggleFlags_Animated, with a duration to animate for.
+    bool HasCircleKnob = true;              // Config.KnobRounding is fully round.
+    float LabelOffsetX = 0.0f;              // How far the label is moved over, for a knob offset outside of the frame when on.
+};
+
+// ImGuiToggleStats: What a context's toggles cost in a frame. See ImGui::GetToggleStats().
+struct ImGuiToggleStats
+{
+    int ToggleCount = 0;                    // Toggles submitted, counting each toggle in a grid.
+    int ClippedCount = 0;                   // Toggles not drawn, as they were outside the window's clipping rectangle.
+    int AnimatingCount = 0;                 // Toggles drawn mid-animation.
+    int RetainedCount = 0;                  // Toggles that copied what they drew last frame, instead of drawing again.
+    int VertexCount = 0;                    // Vertices emitted into draw lists by toggles, not counting their labels.
+    int IndexCount = 0;                     // Indices emitted into draw lists by toggles, not counting their labels.
+    int PaletteBlendCount = 0;              // Palettes blended between their off and on colors, for animating toggles.
+    int TextMeasureCount = 0;               // Labels measured, rather than found in the label cache.
+};
@@ -0,0 +1,163 @@
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif // IMGUI_DEFINE_MATH_OPERATORS
+
+#include "imgui_toggle_animation.h"
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+namespace
+{
+    // removes a key from a storage, rather than zeroing its value, so the storage only ever holds keys in use.
+    // the pairs are sorted by key, as ImGuiStorage keeps them.
+    void EraseStorageKey(ImGuiStorage& storage, ImGuiID key)
+    {
+        int first = 0;
+        int count = storage.Data.Size;
+        while (count > 0)
+        {
+            const int step = count / 2;
+            if (storage.Data[first + step].key < key)
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+
+        if (first < storage.Data.Size && storage.Data[first].key == key)
+        {
+            storage.Data.erase(storage.Data.Data + first);
+        }
+    }
+} // namespace
+
+void ImGuiToggleAnimationPool::Start(ImGuiID id, float from, float to, double time, float duration)
+{
+    IM_ASSERT(id != 0);
+
+    if (duration <= 0.0f)
+    {
+        Stop(id);
+        return;
+    }
+
+    int* slot_reference = SlotIndices.GetIntRef(id, 0);
+    int slot_index = *slot_reference - 1;
+
+    if (slot_index < 0)
+    {
+        // reuse a finished animation's slot if there is one, otherwise grow.
+        if (!FreeSlots.empty())
+        {
+            slot_index = FreeSlots.back();
+            FreeSlots.pop_back();
+        }
+        else
+        {
+            slot_index = Slots.Size;
+            Slots.push_back(ImGuiToggleAnimation());
+        }
+
+        *slot_reference = slot_index + 1;
+        ++ActiveCount;
+    }
+
+    ImGuiToggleAnimation& animation = Slots[slot_index];
+    animation.Id = id;
+    animation.StartTime = time;
+    animation.EndTime = time + duration;
+    animation.From = from;
+    animation.To = to;
+}
+
+void ImGuiToggleAnimationPool::Stop(ImGuiID id)
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    const int slot_index = SlotIndices.GetInt(id, 0) - 1;
+    if (slot_index >= 0)
+    {
+        Retire(slot_index);
+    }
+}
+
+bool ImGuiToggleAnimationPool::Sample(ImGuiID id, double time, float* value)
+{
+    // most of the time nothing is animating, so skip the lookup.
+    if (IsEmpty())
+    {
+        return false;
+    }
+
+    const int slot_index = SlotIndices.GetInt(id, 0) - 1;
+    if (slot_index < 0)
+    {
+        return false;
+    }
+
+    const ImGuiToggleAnimation& animation = Slots[slot_index];
+    if (time >= animation.EndTime)
+    {
+        Retire(slot_index);
+        return false;
+    }
+
+    const float progress = ImSaturate((float)((time - animation.StartTime) / (animation.EndTime - animation.StartTime)));
+    *value = ImLerp(animation.From, animation.To, progress);
+    return true;
+}
+
+void ImGuiToggleAnimationPool::RetireFinished(double time)
+{
+    for (int i = 0; i < Slots.Size && !IsEmpty(); ++i)
+    {
+        if (Slots[i].Id != 0 && time >= Slots[i].EndTime)
+        {
+            Retire(i);
+        }
+    }
+}
+
+double ImGuiToggleAnimationPool::GetEndTime(double time) const
+{
+    // finished animations may not have been retired yet, so they are skipped by time rather than by slot.
+    double end_time = -1.0;
+    for (int i = 0; i < Slots.Size && !IsEmpty(); ++i)
+    {
+        if (Slots[i].Id != 0 && Slots[i].EndTime > time)
+        {
+            end_time = ImMax(end_time, Slots[i].EndTime);
+        }
+    }
+
+    return end_time;
+}
+
+void ImGuiToggleAnimationPool::Retire(int slot_index)
+{
+    ImGuiToggleAnimation& animation = Slots[slot_index];
+    IM_ASSERT(animation.Id != 0);
+
+    ::EraseStorageKey(SlotIndices, animation.Id);
+    animation.Id = 0;
+    --ActiveCount;
+
+    // once everything has finished, start over from empty. resizing to zero keeps the memory for next time.
+    if (IsEmpty())
+    {
+        Slots.resize(0);
+        FreeSlots.resize(0);
+        SlotIndices.Data.resize(0);
+        return;
+    }
+
+    FreeSlots.push_back(slot_index);
+}
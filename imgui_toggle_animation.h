@@ -0,0 +1,45 @@
+#pragma once
+
+#include "imgui.h"
+
+// ImGuiToggleAnimation: A single toggle animating from one value to another.
+struct ImGuiToggleAnimation
+{
+    ImGuiID Id;                             // The toggle being animated, or 0 if this slot is free.
+    double StartTime;
+    double EndTime;
+    float From;
+    float To;
+};
+
+// ImGuiToggleAnimationPool: The toggle animations in flight for a context, keyed by toggle ID.
+//   Slots of finished animations are put on a free list and reused, so once the pool has grown
+//   to the most animations in flight at once, starting and finishing animations doesn't allocate.
+struct ImGuiToggleAnimationPool
+{
+    ImVector<ImGuiToggleAnimation> Slots;
+    ImVector<int> FreeSlots;
+    ImGuiStorage SlotIndices;               // Toggle ID -> slot index + 1, for toggles animating only.
+    int ActiveCount = 0;
+
+    // Starts animating a toggle, replacing any animation it already has. A duration of zero or less stops it instead.
+    void Start(ImGuiID id, float from, float to, double time, float duration);
+
+    // Stops animating a toggle, if it is.
+    void Stop(ImGuiID id);
+
+    // Writes the toggle's animated value at `time` to `value` and returns true if it is animating.
+    // Animations that have finished are retired, and leave `value` untouched.
+    bool Sample(ImGuiID id, double time, float* value);
+
+    // Retires every animation that has finished by `time`. Only visits slots in use, not every toggle.
+    void RetireFinished(double time);
+
+    // Gets the time the last animation still running at `time` will finish, or -1.0 if none are.
+    double GetEndTime(double time) const;
+
+    bool IsEmpty() const { return ActiveCount == 0; }
+
+private:
+    void Retire(int slot_index);
+};
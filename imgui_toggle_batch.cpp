@@ -0,0 +1,227 @@
+#include "imgui_toggle_batch.h"
+
+namespace
+{
+    // the most vertices written by a chunk: enough work to be worth a job, and well within the range of 16-bit indices.
+    const int ChunkVertexLimit = 1 << 14;
+
+    inline bool IsColorVisible(ImU32 color)
+    {
+        return (color & IM_COL32_A_MASK) != 0;
+    }
+
+    // fills one chunk of a batch from the shapes' templates. this touches no ImGui state, so it can run on any thread.
+    void WriteBatchChunk(void* job_data, int chunk_index)
+    {
+        const ImGuiToggleBatch* batch = static_cast<const ImGuiToggleBatch*>(job_data);
+        const ImGuiToggleBatchChunk& chunk = batch->Chunks[chunk_index];
+
+        ImDrawVert* vertex_write = batch->FlushDrawList->VtxBuffer.Data + chunk.VertexStart;
+        ImDrawIdx* index_write = batch->FlushDrawList->IdxBuffer.Data + chunk.IndexStart;
+        unsigned int vertex_base = chunk.VertexBase;
+
+        for (int i = chunk.PartStart; i < chunk.PartEnd; ++i)
+        {
+            const ImGuiToggleMeshTemplate* mesh = batch->PartTemplates[i];
+            if (mesh == nullptr)
+            {
+                continue;
+            }
+
+            ImGui::WriteToggleMesh(vertex_write, index_write, vertex_base, *mesh, batch->PartOrigins[i], batch->PartColors[i]);
+            vertex_write += mesh->Vertices.Size;
+            index_write += mesh->Indices.Size;
+            vertex_base += mesh->Vertices.Size;
+        }
+    }
+} // namespace
+
+ImGuiToggleBatch::~ImGuiToggleBatch()
+{
+    Clear();
+}
+
+void ImGuiToggleBatch::Begin(ImDrawList* draw_list)
+{
+    IM_ASSERT_USER_ERROR(!IsOpen(), "BeginToggleBatch() was called while a toggle batch was already open.");
+
+    DrawList = draw_list;
+
+    // resizing to zero keeps the memory from the last batch.
+    PartKeys.resize(0);
+    PartOrigins.resize(0);
+    PartColors.resize(0);
+    PartAllowCapture.resize(0);
+    ClipRectStarts.resize(0);
+    ClipRects.resize(0);
+}
+
+void ImGuiToggleBatch::AddParts(const ImGuiToggleMeshPart* parts, int part_count, bool allow_capture)
+{
+    IM_ASSERT(IsOpen());
+
+    // start a new run if the clipping rectangle has changed since the last shape.
+    const ImVec4& clip_rect = DrawList->_CmdHeader.ClipRect;
+    if (ClipRects.empty() || memcmp(&ClipRects.back(), &clip_rect, sizeof(clip_rect)) != 0)
+    {
+        ClipRectStarts.push_back(PartKeys.Size);
+        ClipRects.push_back(clip_rect);
+    }
+
+    for (int i = 0; i < part_count; ++i)
+    {
+        PartKeys.push_back(parts[i].Key);
+        PartOrigins.push_back(parts[i].Origin);
+        PartColors.push_back(parts[i].Color);
+        PartAllowCapture.push_back(allow_capture);
+    }
+}
+
+void ImGuiToggleBatch::End(ImGuiToggleMeshCache* mesh_cache, ImGuiToggleJobDispatcher dispatcher, void* dispatcher_user_data)
+{
+    IM_ASSERT_USER_ERROR(IsOpen(), "EndToggleBatch() was called without a matching BeginToggleBatch().");
+
+    ImDrawList* draw_list = DrawList;
+    DrawList = nullptr;
+
+    ResolveTemplates(mesh_cache, draw_list);
+    ReserveChunks(draw_list);
+
+    FlushDrawList = draw_list;
+
+    // only hand the work out if there is more than one job's worth of it.
+    if (dispatcher != nullptr && Chunks.Size > 1)
+    {
+        dispatcher(::WriteBatchChunk, this, Chunks.Size, dispatcher_user_data);
+    }
+    else
+    {
+        for (int i = 0; i < Chunks.Size; ++i)
+        {
+            ::WriteBatchChunk(this, i);
+        }
+    }
+
+    FlushDrawList = nullptr;
+}
+
+void ImGuiToggleBatch::Clear()
+{
+    // ImVector doesn't destroy its elements, so free each transient template's buffers first.
+    for (int i = 0; i < TransientTemplates.Size; ++i)
+    {
+        TransientTemplates[i].Vertices.clear();
+        TransientTemplates[i].Indices.clear();
+    }
+
+    TransientTemplates.clear();
+    PartKeys.clear();
+    PartOrigins.clear();
+    PartColors.clear();
+    PartAllowCapture.clear();
+    PartTemplates.clear();
+    ClipRectStarts.clear();
+    ClipRects.clear();
+    Chunks.clear();
+    DrawList = nullptr;
+    FlushDrawList = nullptr;
+}
+
+void ImGuiToggleBatch::ResolveTemplates(ImGuiToggleMeshCache* mesh_cache, ImDrawList* draw_list)
+{
+    // remember every shape that can be remembered first. this may clear the cache, so no templates are kept from this pass.
+    for (int i = 0; i < PartKeys.Size; ++i)
+    {
+        if (::IsColorVisible(PartColors[i]) && PartAllowCapture[i])
+        {
+            mesh_cache->FindOrCapture(draw_list, PartKeys[i]);
+        }
+    }
+
+    // now the cache won't change, find every template, and count the shapes that still need one.
+    PartTemplates.resize(PartKeys.Size);
+    int transient_count = 0;
+
+    for (int i = 0; i < PartKeys.Size; ++i)
+    {
+        PartTemplates[i] = ::IsColorVisible(PartColors[i]) ? mesh_cache->Find(PartKeys[i]) : nullptr;
+        if (PartTemplates[i] == nullptr && ::IsColorVisible(PartColors[i]))
+        {
+            ++transient_count;
+        }
+    }
+
+    // grow the transient templates before pointing at any of them. they are kept between batches to reuse their memory.
+    while (TransientTemplates.Size < transient_count)
+    {
+        TransientTemplates.push_back(ImGuiToggleMeshTemplate());
+    }
+
+    int transient_index = 0;
+    for (int i = 0; i < PartKeys.Size && transient_index < transient_count; ++i)
+    {
+        if (PartTemplates[i] != nullptr || !::IsColorVisible(PartColors[i]))
+        {
+            continue;
+        }
+
+        ImGuiToggleMeshTemplate* mesh = &TransientTemplates[transient_index++];
+        PartTemplates[i] = mesh_cache->Tessellate(mesh, draw_list, PartKeys[i]) ? mesh : nullptr;
+    }
+}
+
+void ImGuiToggleBatch::ReserveChunks(ImDrawList* draw_list)
+{
+    Chunks.resize(0);
+
+    for (int run = 0; run < ClipRects.Size; ++run)
+    {
+        const int run_start = ClipRectStarts[run];
+        const int run_end = run + 1 < ClipRectStarts.Size ? ClipRectStarts[run + 1] : PartKeys.Size;
+        const ImVec4& clip_rect = ClipRects[run];
+
+        // only the reservations are made here, so the draw commands end up with the right clipping and counts.
+        draw_list->PushClipRect(ImVec2(clip_rect.x, clip_rect.y), ImVec2(clip_rect.z, clip_rect.w));
+
+        int chunk_start = run_start;
+        int index_count = 0;
+        int vertex_count = 0;
+
+        for (int i = run_start; i <= run_end; ++i)
+        {
+            const ImGuiToggleMeshTemplate* mesh = i < run_end ? PartTemplates[i] : nullptr;
+            const bool is_run_end = i == run_end;
+            const bool is_chunk_full = mesh != nullptr && vertex_count > 0 && vertex_count + mesh->Vertices.Size > ::ChunkVertexLimit;
+
+            if ((is_run_end || is_chunk_full) && vertex_count > 0)
+            {
+                draw_list->PrimReserve(index_count, vertex_count);
+
+                ImGuiToggleBatchChunk chunk;
+                chunk.PartStart = chunk_start;
+                chunk.PartEnd = i;
+                chunk.VertexStart = (int)(draw_list->_VtxWritePtr - draw_list->VtxBuffer.Data);
+                chunk.IndexStart = (int)(draw_list->_IdxWritePtr - draw_list->IdxBuffer.Data);
+                chunk.VertexBase = draw_list->_VtxCurrentIdx;
+                Chunks.push_back(chunk);
+
+                // the chunk will be written later, so move the draw list past it now.
+                draw_list->_VtxWritePtr += vertex_count;
+                draw_list->_IdxWritePtr += index_count;
+                draw_list->_VtxCurrentIdx += vertex_count;
+
+                chunk_start = i;
+                index_count = 0;
+                vertex_count = 0;
+            }
+
+            if (mesh != nullptr)
+            {
+                index_count += mesh->Indices.Size;
+                vertex_count += mesh->Vertices.Size;
+            }
+        }
+
+        draw_list->PopClipRect();
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif // IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+
+#include "imgui_toggle.h"
+#include "imgui_toggle_mesh.h"
+
+// ImGuiToggleBatchChunk: A run of a batch's shapes, written to its own range of the draw list's vertices and indices.
+struct ImGuiToggleBatchChunk
+{
+    int PartStart;
+    int PartEnd;
+    int VertexStart;                        // Offset into the draw list's VtxBuffer.
+    int IndexStart;                         // Offset into the draw list's IdxBuffer.
+    unsigned int VertexBase;                // The draw list vertex index of the chunk's first vertex.
+};
+
+// ImGuiToggleBatch: Shapes recorded by toggles between `ImGui::BeginToggleBatch()` and `ImGui::EndToggleBatch()`, to be drawn all at once.
+//   Shapes are recorded fully resolved (geometry, position and color), as a structure of arrays so drawing them only reads what it needs.
+//   The clipping rectangle each shape was recorded with is kept as runs, so shapes are clipped just as if they had been drawn immediately.
+//   When the batch ends, every shape's template is found or tessellated, and space for all of them is reserved in the draw list in chunks.
+//   The chunks are then filled from the templates, which uses no ImGui state, so they can be filled on other threads.
+struct ImGuiToggleBatch
+{
+    ImDrawList* DrawList = nullptr;         // The draw list the batch draws into, or null if no batch is open.
+
+    // one element per shape.
+    ImVector<ImGuiToggleMeshKey> PartKeys;
+    ImVector<ImVec2> PartOrigins;
+    ImVector<ImU32> PartColors;
+    ImVector<bool> PartAllowCapture;
+    ImVector<const ImGuiToggleMeshTemplate*> PartTemplates;
+
+    // one element per run of shapes with the same clipping rectangle.
+    ImVector<int> ClipRectStarts;           // The index of the first shape in the run.
+    ImVector<ImVec4> ClipRects;
+
+    // shapes that can't be remembered, such as those of animating toggles, are tessellated into these for the batch.
+    ImVector<ImGuiToggleMeshTemplate> TransientTemplates;
+
+    ImVector<ImGuiToggleBatchChunk> Chunks;
+    ImDrawList* FlushDrawList = nullptr;    // The draw list being filled by the chunks.
+
+    ~ImGuiToggleBatch();
+
+    bool IsOpen() const { return DrawList != nullptr; }
+
+    void Begin(ImDrawList* draw_list);
+    void AddParts(const ImGuiToggleMeshPart* parts, int part_count, bool allow_capture);
+    void End(ImGuiToggleMeshCache* mesh_cache, ImGuiToggleJobDispatcher dispatcher, void* dispatcher_user_data);
+
+    // Frees everything the batch kept between batches, discarding any open batch.
+    void Clear();
+
+private:
+    void ResolveTemplates(ImGuiToggleMeshCache* mesh_cache, ImDrawList* draw_list);
+    void ReserveChunks(ImDrawList* draw_list);
+};
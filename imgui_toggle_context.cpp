@@ -0,0 +1,110 @@
+#include "imgui_toggle_context.h"
+
+#include <atomic>
+
+namespace
+{
+    // the last toggle state found, and the context it belongs to, so lookups only scan the context's hooks when the current context changes.
+    // it's per thread, as each thread may drive its own context. a context shutting down on another thread bumps the generation,
+    // so a new context allocated at the same address is never mistaken for the old one.
+    thread_local ImGuiContext* CachedContext = nullptr;
+    thread_local ImGuiToggleContext* CachedToggleContext = nullptr;
+    thread_local unsigned int CachedGeneration = 0;
+    std::atomic<unsigned int> ShutdownGeneration(0);
+
+    // per-frame housekeeping for a context's toggle state.
+    void NewFrameToggleContext(ImGuiContext* context, ImGuiContextHook* hook)
+    {
+        ImGuiToggleContext* toggle_context = static_cast<ImGuiToggleContext*>(hook->UserData);
+
+        // retire animations for toggles that finished without being drawn again, such as those scrolled out of view.
+        toggle_context->Animations.RetireFinished(context->Time);
+
+        // forget labels that haven't been drawn for a while.
+        toggle_context->LabelCache.EvictUnused(context->FrameCount);
+
+        // and toggles that haven't been drawn for a while.
+        toggle_context->Retained.EvictUnused(context->FrameCount);
+
+        // and toggle lists that haven't been drawn for a while.
+        toggle_context->Lists.EvictUnused(context->FrameCount);
+
+        // and scaled presets that haven't been used for a while.
+        toggle_context->PresetCache.EvictUnused(context->FrameCount);
+
+#ifdef IMGUI_TOGGLE_ENABLE_STATS
+        // keep last frame's stats, and start counting this one.
+        toggle_context->Stats.NewFrame();
+#endif
+    }
+
+    // destroys a context's toggle state along with the context.
+    void ShutdownToggleContext(ImGuiContext* context, ImGuiContextHook* hook)
+    {
+        IM_UNUSED(context);
+
+        ImGuiToggleContext* toggle_context = static_cast<ImGuiToggleContext*>(hook->UserData);
+        IM_DELETE(toggle_context);
+        hook->UserData = nullptr;
+
+        CachedContext = nullptr;
+        CachedToggleContext = nullptr;
+        ShutdownGeneration.fetch_add(1, std::memory_order_relaxed);
+    }
+} // namespace
+
+ImGuiToggleContext* ImGui::GetToggleContext()
+{
+    ImGuiToggleContext* toggle_context = ImGui::FindToggleContext();
+    if (toggle_context != nullptr)
+    {
+        return toggle_context;
+    }
+
+    ImGuiContext& g = *GImGui;
+    toggle_context = IM_NEW(ImGuiToggleContext)();
+
+    ImGuiContextHook new_frame_hook;
+    new_frame_hook.Type = ImGuiContextHookType_NewFramePre;
+    new_frame_hook.Callback = ::NewFrameToggleContext;
+    new_frame_hook.UserData = toggle_context;
+    ImGui::AddContextHook(&g, &new_frame_hook);
+
+    ImGuiContextHook shutdown_hook;
+    shutdown_hook.Type = ImGuiContextHookType_Shutdown;
+    shutdown_hook.Callback = ::ShutdownToggleContext;
+    shutdown_hook.UserData = toggle_context;
+    ImGui::AddContextHook(&g, &shutdown_hook);
+
+    CachedContext = &g;
+    CachedToggleContext = toggle_context;
+    CachedGeneration = ShutdownGeneration.load(std::memory_order_relaxed);
+
+    return toggle_context;
+}
+
+ImGuiToggleContext* ImGui::FindToggleContext()
+{
+    ImGuiContext& g = *GImGui;
+
+    const unsigned int generation = ShutdownGeneration.load(std::memory_order_relaxed);
+    if (CachedContext == &g && CachedGeneration == generation)
+    {
+        return CachedToggleContext;
+    }
+
+    // the toggle state is stored on the context itself, as the user data of our shutdown hook.
+    for (int i = 0; i < g.Hooks.Size; ++i)
+    {
+        const ImGuiContextHook& hook = g.Hooks[i];
+        if (hook.Callback == ::ShutdownToggleContext && hook.Type == ImGuiContextHookType_Shutdown)
+        {
+            CachedContext = &g;
+            CachedToggleContext = static_cast<ImGuiToggleContext*>(hook.UserData);
+            CachedGeneration = generation;
+            return CachedToggleContext;
+        }
+    }
+
+    return nullptr;
+}
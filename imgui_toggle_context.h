@@ -0,0 +1,86 @@
+#pragma once
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif // IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+
+#include "imgui_toggle_animation.h"
+#include "imgui_toggle_batch.h"
+#include "imgui_toggle_events.h"
+#include "imgui_toggle_label.h"
+#include "imgui_toggle_list.h"
+#include "imgui_toggle_mesh.h"
+#include "imgui_toggle_palette.h"
+#include "imgui_toggle_presets.h"
+#include "imgui_toggle_renderer.h"
+#include "imgui_toggle_retained.h"
+#include "imgui_toggle_sprites.h"
+#include "imgui_toggle_stats.h"
+
+// ImGuiToggleContext: State shared by every toggle drawn in a single ImGui context.
+//   One is created for each ImGuiContext the first time a toggle is drawn in it, and is destroyed along with that context.
+//   Nothing is shared between contexts, so contexts on different threads can draw toggles at the same time.
+struct ImGuiToggleContext
+{
+    ImGuiToggleContext() : Renderer(this)
+    {
+        LabelCache.Stats = &Stats.Current;
+    }
+
+    // The renderer every toggle in the context is drawn with.
+    ImGuiToggleRenderer Renderer;
+
+    // The config the `Toggle()` overloads without a config fill out to call the renderer with.
+    ImGuiToggleConfig AliasConfig;
+
+    // Palettes resolved against the style, reused between toggles and frames.
+    ImGuiTogglePaletteCache PaletteCache;
+
+    // Tessellated shapes, copied into draw lists instead of being tessellated again.
+    ImGuiToggleMeshCache MeshCache;
+
+    // Round shapes baked into the font atlas, used by the mesh cache once baked.
+    ImGuiToggleSpriteAtlas Sprites;
+
+    // What each toggle drew last time, copied back while it draws the same way.
+    ImGuiToggleRetainedCache Retained;
+
+    // Shapes recorded by toggles in an open batch, drawn when the batch ends.
+    ImGuiToggleBatch Batch;
+
+    // Runs the jobs that fill a batch's vertices, or null to fill them on the calling thread.
+    ImGuiToggleJobDispatcher JobDispatcher = nullptr;
+    void* JobDispatcherUserData = nullptr;
+
+    // Changes to toggles, recorded for other threads when given a capacity.
+    ImGuiToggleEventRing Events;
+
+    // The toggles currently animating.
+    ImGuiToggleAnimationPool Animations;
+
+    // Label sizes, measured once and reused between toggles and frames.
+    ImGuiToggleLabelCache LabelCache;
+
+    // Labels interned for `ToggleEx()`, kept until the context is destroyed.
+    ImGuiToggleLabelArena InternedLabels;
+
+    // The filter index of each filtered toggle list.
+    ImGuiToggleListCache Lists;
+
+    // Presets that scale with the font size, built once for each scale and font size.
+    ImGuiTogglePresetCache PresetCache;
+
+    // What toggles cost this frame, and in recent frames. Only counted when IMGUI_TOGGLE_ENABLE_STATS is defined, but always stored.
+    ImGuiToggleStatsHistory Stats;
+};
+
+namespace ImGui
+{
+    // Gets the toggle state for the current ImGui context, creating it if needed.
+    ImGuiToggleContext* GetToggleContext();
+
+    // Gets the toggle state for the current ImGui context, or null if no toggle has been drawn in it yet.
+    ImGuiToggleContext* FindToggleContext();
+}
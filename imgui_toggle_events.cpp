@@ -0,0 +1,85 @@
+#include "imgui_toggle_events.h"
+#include "imgui_toggle_context.h"
+
+ImGuiToggleEventRing::~ImGuiToggleEventRing()
+{
+    Resize(0);
+}
+
+void ImGuiToggleEventRing::Resize(int capacity)
+{
+    IM_ASSERT_USER_ERROR(capacity >= 0, "Toggle event capacity specified was negative.");
+    IM_ASSERT_USER_ERROR(capacity <= (1 << 30), "Toggle event capacity specified was too large to round up to a power of two.");
+
+    if (Events != nullptr)
+    {
+        IM_FREE(Events);
+        Events = nullptr;
+    }
+
+    // a power of two capacity lets the head and tail wrap around freely, and be masked into an index.
+    Capacity = capacity > 0 ? (unsigned int)ImUpperPowerOfTwo(capacity) : 0;
+    if (Capacity != 0)
+    {
+        Events = (ImGuiToggleEvent*)IM_ALLOC(sizeof(ImGuiToggleEvent) * Capacity);
+    }
+
+    Head.store(0, std::memory_order_relaxed);
+    Tail.store(0, std::memory_order_relaxed);
+    DroppedCount.store(0, std::memory_order_relaxed);
+}
+
+bool ImGuiToggleEventRing::Push(const ImGuiToggleEvent& event)
+{
+    if (Capacity == 0)
+    {
+        return false;
+    }
+
+    // the producer owns the head, and only needs to see how far the consumer has read.
+    const unsigned int head = Head.load(std::memory_order_relaxed);
+    const unsigned int tail = Tail.load(std::memory_order_acquire);
+    if (head - tail >= Capacity)
+    {
+        DroppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // publish the event only once it's written.
+    Events[head & (Capacity - 1)] = event;
+    Head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+int ImGuiToggleEventRing::Drain(ImGuiToggleEvent* out_events, int max_count)
+{
+    IM_ASSERT(out_events != nullptr || max_count <= 0);
+
+    if (Capacity == 0 || max_count <= 0)
+    {
+        return 0;
+    }
+
+    // the consumer owns the tail, and only reads events the producer has published.
+    const unsigned int tail = Tail.load(std::memory_order_relaxed);
+    const unsigned int head = Head.load(std::memory_order_acquire);
+    const int count = ImMin((int)(head - tail), max_count);
+    for (int i = 0; i < count; ++i)
+    {
+        out_events[i] = Events[(tail + (unsigned int)i) & (Capacity - 1)];
+    }
+
+    // hand the slots back to the producer only once they're copied.
+    Tail.store(tail + (unsigned int)count, std::memory_order_release);
+    return count;
+}
+
+void ImGui::SetToggleEventCapacity(int capacity)
+{
+    ImGui::GetToggleContext()->Events.Resize(capacity);
+}
+
+ImGuiToggleEventRing* ImGui::GetToggleEventRing()
+{
+    return &ImGui::GetToggleContext()->Events;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include <atomic>
+
+// ImGuiToggleEvent: A toggle's value changing, as recorded into a context's event ring.
+struct ImGuiToggleEvent
+{
+    ImGuiID Id;                             // The toggle's ID. For a toggle in a grid, its index hashed with the grid's ID.
+    bool Value;                             // The value the toggle changed to.
+    double Time;                            // `ImGui::GetTime()` when it changed.
+};
+
+// ImGuiToggleEventRing: A fixed size ring of toggle events, written by the thread drawing the context's toggles and drained by a single other thread.
+//   It's lock-free and never allocates once created: when it's full, new events are dropped and counted rather than waiting for room.
+struct ImGuiToggleEventRing
+{
+    ImGuiToggleEvent* Events = nullptr;
+    unsigned int Capacity = 0;              // Always a power of two, or 0 when no events are recorded.
+    std::atomic<unsigned int> Head{ 0 };    // The next event to write, only advanced by the producer.
+    char HeadPadding[64];                   // Keeps `Head` and `Tail` on their own cache lines, so each thread only writes its own.
+    std::atomic<unsigned int> Tail{ 0 };    // The next event to read, only advanced by the consumer.
+    std::atomic<unsigned int> DroppedCount{ 0 };
+
+    ImGuiToggleEventRing() {}
+    ImGuiToggleEventRing(const ImGuiToggleEventRing&) = delete;
+    ImGuiToggleEventRing& operator=(const ImGuiToggleEventRing&) = delete;
+    ~ImGuiToggleEventRing();
+
+    // Makes room for at least `capacity` events, rounded up to a power of two, and discards any events not yet drained. 0 stops recording events.
+    // The capacity can be at most 2^30.
+    // Not thread-safe: only resize the ring while nothing is draining it.
+    void Resize(int capacity);
+    inline bool IsEnabled() const { return Capacity != 0; }
+
+    // Records an event, returning false if it was dropped as the ring is full. Only call from the producer thread.
+    bool Push(const ImGuiToggleEvent& event);
+
+    // Copies up to `max_count` of the oldest events into `out_events`, returning how many were copied. Only call from the consumer thread.
+    int Drain(ImGuiToggleEvent* out_events, int max_count);
+};
+
+namespace ImGui
+{
+    // Widgets: Toggle Switches over Atomics
+    // - The value is loaded once as the toggle is drawn, and only stored when the toggle is pressed, so other threads may read it at any time.
+    // - Loads acquire and stores release, so a thread that sees the new value also sees what was written before the toggle was pressed.
+    IMGUI_API bool Toggle(const char* label, std::atomic<bool>* v, const ImVec2& size = ImVec2());
+    IMGUI_API bool Toggle(const char* label, std::atomic<bool>* v, const ImGuiToggleConfig& config);
+
+    // Toggle Events
+    // - Records every change of every toggle drawn in the current context, including toggles in grids, for other threads to pick up without locking.
+    // - SetToggleEventCapacity() allocates a ring for at least `capacity` events, or stops recording events with 0, the default.
+    //   It isn't thread-safe: set the capacity before handing the ring to another thread.
+    // - GetToggleEventRing() returns the current context's ring. A single consumer thread may call `Drain()` on it at any time while the context lives.
+    IMGUI_API void SetToggleEventCapacity(int capacity);
+    IMGUI_API ImGuiToggleEventRing* GetToggleEventRing();
+}
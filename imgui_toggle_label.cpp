@@ -0,0 +1,224 @@
+#include "imgui_toggle_label.h"
+
+namespace
+{
+    // the most labels the cache will hold before starting over.
+    // this is only reached if lots of labels are built with different text every frame.
+    const int LabelCacheCapacity = 8192;
+
+    // how many frames a label can go unused before it is evicted. this is also how often the cache checks for them.
+    const int LabelCacheEvictionFrames = 60;
+
+    // the size of each block of interned labels. longer labels get a block of their own.
+    const int LabelArenaBlockSize = 16 * 1024;
+
+    inline ImGuiID HashLabel(const char* label, int length, bool hide_text_after_double_hash)
+    {
+        ImGuiContext& g = *GImGui;
+
+        // the same text measures differently in another font or size, so both seed the hash.
+        ImGuiID seed = ImHashData(&g.Font, sizeof(g.Font), hide_text_after_double_hash ? 1 : 0);
+        seed = ImHashData(&g.FontSize, sizeof(g.FontSize), seed);
+        return ImHashData(label, length, seed);
+    }
+} // namespace
+
+ImGuiToggleLabelMetrics ImGuiToggleLabelCache::Measure(const char* label, bool hide_text_after_double_hash)
+{
+    ImGuiContext& g = *GImGui;
+    const int length = (int)strlen(label);
+    const ImGuiID key = ::HashLabel(label, length, hide_text_after_double_hash);
+
+    // only trust an entry measured for this very label, as another label may share its key.
+    int index = EntryIndices.GetInt(key, -1);
+    if (index >= 0)
+    {
+        ImGuiToggleLabelCacheEntry& entry = Entries[index];
+        if (entry.Font == g.Font && entry.FontSize == g.FontSize && entry.HideTextAfterDoubleHash == hide_text_after_double_hash
+            && entry.TextLength == length && memcmp(Text.Data + entry.TextOffset, label, length) == 0)
+        {
+            entry.LastFrameUsed = g.FrameCount;
+            return entry.Metrics;
+        }
+    }
+
+    IMGUI_TOGGLE_STATS_ADD(*Stats, TextMeasureCount, 1);
+
+    ImGuiToggleLabelMetrics metrics;
+    metrics.Size = ImGui::CalcTextSize(label, nullptr, hide_text_after_double_hash);
+    metrics.RenderedLength = hide_text_after_double_hash
+        ? (int)(ImGui::FindRenderedTextEnd(label, label + length) - label)
+        : length;
+
+    if (Entries.Size >= ::LabelCacheCapacity)
+    {
+        Clear();
+        index = -1;
+    }
+
+    // a label that shares its key with another takes over its entry, so the cache never holds two entries for a key.
+    if (index < 0)
+    {
+        index = Entries.Size;
+        EntryIndices.SetInt(key, index);
+        Entries.push_back(ImGuiToggleLabelCacheEntry());
+    }
+
+    ImGuiToggleLabelCacheEntry& entry = Entries[index];
+    entry.Key = key;
+    entry.LastFrameUsed = g.FrameCount;
+    entry.Metrics = metrics;
+    entry.Font = g.Font;
+    entry.FontSize = g.FontSize;
+    entry.HideTextAfterDoubleHash = hide_text_after_double_hash;
+    entry.TextOffset = Text.Size;
+    entry.TextLength = length;
+    Text.resize(Text.Size + length);
+    memcpy(Text.Data + entry.TextOffset, label, length);
+
+    return metrics;
+}
+
+void ImGuiToggleLabelCache::EvictUnused(int frame_count)
+{
+    if (frame_count - LastEvictionFrame < ::LabelCacheEvictionFrames)
+    {
+        return;
+    }
+
+    LastEvictionFrame = frame_count;
+
+    // compact the entries that are still in use to the front, and their text along with them.
+    // the text of entries that took over another's entry is left behind here too.
+    int kept_count = 0;
+    int kept_text_size = 0;
+    for (int i = 0; i < Entries.Size; ++i)
+    {
+        ImGuiToggleLabelCacheEntry& entry = Entries[i];
+        if (frame_count - entry.LastFrameUsed < ::LabelCacheEvictionFrames)
+        {
+            memmove(Text.Data + kept_text_size, Text.Data + entry.TextOffset, entry.TextLength);
+            entry.TextOffset = kept_text_size;
+            kept_text_size += entry.TextLength;
+            Entries[kept_count++] = entry;
+        }
+    }
+
+    Text.resize(kept_text_size);
+
+    if (kept_count == Entries.Size)
+    {
+        return;
+    }
+
+    Entries.resize(kept_count);
+
+    // rebuild the indices in one go, rather than inserting them one at a time.
+    EntryIndices.Data.resize(kept_count);
+    for (int i = 0; i < kept_count; ++i)
+    {
+        EntryIndices.Data[i].key = Entries[i].Key;
+        EntryIndices.Data[i].val_i = i;
+    }
+    EntryIndices.BuildSortByKey();
+}
+
+void ImGuiToggleLabelCache::Clear()
+{
+    Entries.resize(0);
+    EntryIndices.Data.resize(0);
+    Text.resize(0);
+}
+
+ImGuiToggleLabelMetrics ImGuiToggleLabelCache::Measure(const ImGuiToggleLabel& label)
+{
+    ImGuiContext& g = *GImGui;
+
+    ImGuiToggleLabelMetrics metrics;
+    metrics.RenderedLength = label.RenderedLength;
+
+    if (label.SizeFont != g.Font || label.SizeFontSize != g.FontSize)
+    {
+        IMGUI_TOGGLE_STATS_ADD(*Stats, TextMeasureCount, 1);
+
+        // the visible length is known, so there's no "##" to look for.
+        label.Size = ImGui::CalcTextSize(label.Text, label.Text + label.RenderedLength, false);
+        label.SizeFont = g.Font;
+        label.SizeFontSize = g.FontSize;
+    }
+
+    metrics.Size = label.Size;
+    return metrics;
+}
+
+ImGuiToggleLabelArena::~ImGuiToggleLabelArena()
+{
+    Clear();
+}
+
+const ImGuiToggleLabel* ImGuiToggleLabelArena::Intern(const char* label)
+{
+    const size_t length = strlen(label);
+    const ImGuiID hash = ImHashStr(label, length);
+
+    // labels are found again by their hash. labels that share a hash are stored at the keys following it,
+    // so the first free key after the hash is where the label goes if it isn't interned yet.
+    ImGuiID key = hash;
+    ImGuiToggleLabel* interned = (ImGuiToggleLabel*)Labels.GetVoidPtr(key);
+    while (interned != nullptr)
+    {
+        if (interned->Hash == hash && strcmp(interned->Text, label) == 0)
+        {
+            return interned;
+        }
+
+        interned = (ImGuiToggleLabel*)Labels.GetVoidPtr(++key);
+    }
+
+    // the label is followed by its text, in the same allocation.
+    const int size = (int)IM_MEMALIGN(sizeof(ImGuiToggleLabel) + length + 1, sizeof(void*));
+    char* memory = nullptr;
+    if (size > ::LabelArenaBlockSize)
+    {
+        // a label too long for a block gets one of its own, leaving the block being filled as it is.
+        memory = (char*)IM_ALLOC(size);
+        Blocks.push_back(memory);
+    }
+    else
+    {
+        if (Block == nullptr || BlockUsed + size > ::LabelArenaBlockSize)
+        {
+            Block = (char*)IM_ALLOC(::LabelArenaBlockSize);
+            Blocks.push_back(Block);
+            BlockUsed = 0;
+        }
+
+        memory = Block + BlockUsed;
+        BlockUsed += size;
+    }
+
+    char* text = memory + sizeof(ImGuiToggleLabel);
+    memcpy(text, label, length + 1);
+
+    interned = IM_PLACEMENT_NEW(memory) ImGuiToggleLabel();
+    interned->Text = text;
+    interned->RenderedLength = (int)(ImGui::FindRenderedTextEnd(text, text + length) - text);
+    interned->Hash = hash;
+
+    Labels.SetVoidPtr(key, interned);
+
+    return interned;
+}
+
+void ImGuiToggleLabelArena::Clear()
+{
+    for (int i = 0; i < Blocks.Size; ++i)
+    {
+        IM_FREE(Blocks[i]);
+    }
+
+    Blocks.clear();
+    Block = nullptr;
+    BlockUsed = 0;
+    Labels.Clear();
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif // IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+
+#include "imgui_toggle.h"
+#include "imgui_toggle_stats.h"
+
+// ImGuiToggleLabelMetrics: The measurements of a label in a given font.
+struct ImGuiToggleLabelMetrics
+{
+    ImVec2 Size;                            // The size of the label, as `ImGui::CalcTextSize()`.
+    int RenderedLength;                     // The length of the label's visible text, so `label + RenderedLength` is where drawing stops.
+};
+
+// ImGuiToggleLabelCacheEntry: A label's metrics, what they were measured for, and the last frame they were used.
+struct ImGuiToggleLabelCacheEntry
+{
+    ImGuiID Key;
+    int LastFrameUsed;
+    ImGuiToggleLabelMetrics Metrics;
+
+    // what the label was measured for, compared on a hit, as different labels can share a key.
+    ImFont* Font;
+    float FontSize;
+    bool HideTextAfterDoubleHash;
+    int TextOffset;                         // Offset of the label's text into the cache's `Text`.
+    int TextLength;
+};
+
+// ImGuiToggleLabelCache: Label measurements reused between toggles and frames, instead of measuring the text each time.
+//   Labels are keyed by their text, the font and the font size, so labels built each frame still hit the cache,
+//   and pushing a different font measures again. Each label's text is kept, so a label is only ever given its own metrics.
+//   Labels that go unused for a while are evicted.
+struct ImGuiToggleLabelCache
+{
+    ImVector<ImGuiToggleLabelCacheEntry> Entries;
+    ImGuiStorage EntryIndices;              // Key -> entry index.
+    ImVector<char> Text;                    // The text of every entry, one after another.
+    int LastEvictionFrame = 0;
+
+    ImGuiToggleStats* Stats = nullptr;      // The stats measured labels are counted in.
+
+    // Measures a label in the current font, hiding any text after a "##" if `hide_text_after_double_hash` is set.
+    ImGuiToggleLabelMetrics Measure(const char* label, bool hide_text_after_double_hash);
+
+    // Measures an interned label's visible text in the current font, reusing its own measurement while the font and size are unchanged.
+    ImGuiToggleLabelMetrics Measure(const ImGuiToggleLabel& label);
+
+    // Evicts labels that haven't been measured for a while. Called once a frame, it only does work every so often.
+    void EvictUnused(int frame_count);
+    void Clear();
+};
+
+// ImGuiToggleLabelArena: Labels interned for ImGui::ToggleEx(), each kept once, at the same address until the arena is cleared.
+//   Labels and their text are packed into large blocks rather than allocated one by one, and are found again by the hash of their text.
+struct ImGuiToggleLabelArena
+{
+    ImVector<char*> Blocks;
+    char* Block = nullptr;                  // The block being filled.
+    int BlockUsed = 0;                      // Bytes used in `Block`.
+    ImGuiStorage Labels;                    // Text hash -> ImGuiToggleLabel*, or the next free key after it for labels sharing a hash.
+
+    ~ImGuiToggleLabelArena();
+
+    // Returns the interned copy of `label`, interning it first if needed.
+    const ImGuiToggleLabel* Intern(const char* label);
+    void Clear();
+};
@@ -0,0 +1,147 @@
+#include "imgui_toggle_list.h"
+#include "imgui_toggle_profile.h"
+
+namespace
+{
+    // how many labels a list checks against its filter each frame.
+    const int ListIndexScanBudget = 1 << 16;
+
+    // how many frames a list can go undrawn before its index is evicted. this is also how often the cache checks for them.
+    const int ListIndexEvictionFrames = 60;
+
+    inline void ResetIndex(ImGuiToggleListIndex& index, ImGuiID filter_hash)
+    {
+        index.FilterHash = filter_hash;
+        index.ScannedCount = 0;
+        index.Matches.resize(0);
+    }
+} // namespace
+
+ImGuiToggleListCache::~ImGuiToggleListCache()
+{
+    Clear();
+}
+
+const ImGuiToggleListIndex& ImGuiToggleListCache::Update(ImGuiID id, const ImGuiToggleListSource& source, const char* filter, int frame_count)
+{
+    IMGUI_TOGGLE_PROFILE_SCOPE("ImGuiToggleListCache::Update");
+    const ImGuiID filter_hash = ImHashStr(filter);
+
+    int slot = IndexIndices.GetInt(id, -1);
+    if (slot < 0)
+    {
+        slot = Indices.Size;
+        IndexIndices.SetInt(id, slot);
+        Indices.push_back(ImGuiToggleListIndex());
+        Indices[slot].Id = id;
+        Indices[slot].Count = 0;
+        ::ResetIndex(Indices[slot], filter_hash);
+    }
+
+    ImGuiToggleListIndex& index = Indices[slot];
+    index.LastFrameUsed = frame_count;
+
+    // a new filter, or rows removed from the list, start the index over. rows added to the end are just checked next.
+    if (index.FilterHash != filter_hash || index.ScannedCount > source.Count)
+    {
+        ::ResetIndex(index, filter_hash);
+    }
+
+    // the filter matches the visible part of each label, ignoring case, as ImGuiTextFilter does.
+    const char* filter_end = filter + strlen(filter);
+    const int scan_end = ImMin(source.Count, index.ScannedCount + ::ListIndexScanBudget);
+    for (int row = index.ScannedCount; row < scan_end; ++row)
+    {
+        const char* label = source.GetLabel(source.UserData, row);
+        const char* label_end = ImGui::FindRenderedTextEnd(label);
+        if (ImStristr(label, label_end, filter, filter_end) != nullptr)
+        {
+            index.Matches.push_back(row);
+        }
+    }
+
+    index.ScannedCount = scan_end;
+    index.Count = source.Count;
+    return index;
+}
+
+bool ImGuiToggleListCache::IsIndexing(int frame_count) const
+{
+    for (const ImGuiToggleListIndex& index : Indices)
+    {
+        if (frame_count - index.LastFrameUsed <= 1 && index.ScannedCount < index.Count)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ImGuiToggleListCache::EvictUnused(int frame_count)
+{
+    if (frame_count - LastEvictionFrame < ::ListIndexEvictionFrames)
+    {
+        return;
+    }
+
+    LastEvictionFrame = frame_count;
+
+    // compact the lists that are still in use to the front, swapping their matches rather than copying them.
+    int kept_count = 0;
+    for (int i = 0; i < Indices.Size; ++i)
+    {
+        ImGuiToggleListIndex& index = Indices[i];
+        if (frame_count - index.LastFrameUsed >= ::ListIndexEvictionFrames)
+        {
+            index.Matches.clear();
+            continue;
+        }
+
+        if (kept_count != i)
+        {
+            ImGuiToggleListIndex& kept = Indices[kept_count];
+            kept.Id = index.Id;
+            kept.LastFrameUsed = index.LastFrameUsed;
+            kept.FilterHash = index.FilterHash;
+            kept.ScannedCount = index.ScannedCount;
+            kept.Count = index.Count;
+            kept.Matches.swap(index.Matches);
+        }
+
+        ++kept_count;
+    }
+
+    if (kept_count == Indices.Size)
+    {
+        return;
+    }
+
+    // free anything left behind past the kept lists.
+    for (int i = kept_count; i < Indices.Size; ++i)
+    {
+        Indices[i].Matches.clear();
+    }
+
+    Indices.resize(kept_count);
+
+    // rebuild the indices in one go, rather than inserting them one at a time.
+    IndexIndices.Data.resize(kept_count);
+    for (int i = 0; i < kept_count; ++i)
+    {
+        IndexIndices.Data[i].key = Indices[i].Id;
+        IndexIndices.Data[i].val_i = i;
+    }
+    IndexIndices.BuildSortByKey();
+}
+
+void ImGuiToggleListCache::Clear()
+{
+    for (int i = 0; i < Indices.Size; ++i)
+    {
+        Indices[i].Matches.clear();
+    }
+
+    Indices.resize(0);
+    IndexIndices.Data.resize(0);
+}
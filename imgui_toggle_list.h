@@ -0,0 +1,43 @@
+#pragma once
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif // IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+
+#include "imgui_toggle.h"
+
+// ImGuiToggleListIndex: The rows of a toggle list whose labels contain its filter, found a slice at a time.
+struct ImGuiToggleListIndex
+{
+    ImGuiID Id;                             // The list's child window ID.
+    int LastFrameUsed;
+    ImGuiID FilterHash;                     // The filter the matches were found for.
+    int Count;                              // How many rows the list had when it was last drawn.
+    int ScannedCount;                       // How many rows have been checked against the filter, from the first.
+    ImVector<int> Matches;                  // The rows that matched, in order.
+};
+
+// ImGuiToggleListCache: The filter index of each filtered toggle list, by ID.
+//   A list's index is built incrementally: each frame checks up to a budget of labels against the filter, so filtering
+//   a million rows doesn't stall a frame, and rows added to the end of the list are checked without starting over.
+//   Lists that go unused for a while are evicted.
+struct ImGuiToggleListCache
+{
+    ImVector<ImGuiToggleListIndex> Indices;
+    ImGuiStorage IndexIndices;              // Id -> index of the list's entry in `Indices`.
+    int LastEvictionFrame = 0;
+
+    ~ImGuiToggleListCache();
+
+    // Brings the index of the list with `id` up to date with `filter` and `source` as far as this frame's budget allows, and returns it.
+    const ImGuiToggleListIndex& Update(ImGuiID id, const ImGuiToggleListSource& source, const char* filter, int frame_count);
+
+    // Returns true if a list drawn recently still has rows to check against its filter.
+    bool IsIndexing(int frame_count) const;
+
+    // Evicts lists that haven't been drawn for a while. Called once a frame, it only does work every so often.
+    void EvictUnused(int frame_count);
+    void Clear();
+};
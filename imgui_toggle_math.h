@@ -18,4 +18,14 @@ namespace ImGuiToggleMath
     // helpers for checking if an ImVec4 is zero or not.
     constexpr inline bool IsZero(const ImVec4& v) { return v.w == 0 && v.x == 0 && v.y == 0 && v.z == 0; }
     constexpr inline bool IsNonZero(const ImVec4& v) { return v.w != 0 || v.x != 0 || v.y != 0 || v.z != 0; }
+
+    // lerp each 8-bit channel of two packed colors, two channels at a time.
+    inline ImU32 ImLerpColorU32(ImU32 a, ImU32 b, float t)
+    {
+        const ImU32 t_b = (ImU32)(ImSaturate(t) * 256.0f);
+        const ImU32 t_a = 256 - t_b;
+        const ImU32 red_blue = (((a & 0x00FF00FF) * t_a + (b & 0x00FF00FF) * t_b) >> 8) & 0x00FF00FF;
+        const ImU32 green_alpha = (((a >> 8) & 0x00FF00FF) * t_a + ((b >> 8) & 0x00FF00FF) * t_b) & 0xFF00FF00;
+        return red_blue | green_alpha;
+    }
 } // namespace
@@ -0,0 +1,344 @@
+#include "imgui_toggle_mesh.h"
+#include "imgui_toggle_sprites.h"
+
+namespace
+{
+    // the most templates the mesh cache will hold before starting over.
+    // toggles in a layout usually share a few sizes, so this is only reached if sizes change constantly.
+    const int MeshCacheCapacity = 512;
+
+    inline ImGuiID HashMeshKey(const ImGuiToggleMeshKey& key)
+    {
+        return ImHashData(&key, sizeof(key));
+    }
+
+    inline bool IsColorVisible(ImU32 color)
+    {
+        return (color & IM_COL32_A_MASK) != 0;
+    }
+
+    // draws a shape with the regular draw list path functions.
+    void DrawPart(ImDrawList* draw_list, const ImGuiToggleMeshPart& part)
+    {
+        const ImGuiToggleMeshKey& key = part.Key;
+
+        switch (key.Shape)
+        {
+        case ImGuiToggleMeshShape_RectFilled:
+            draw_list->AddRectFilled(part.Origin, part.Origin + key.Size, part.Color, key.Rounding);
+            break;
+        case ImGuiToggleMeshShape_RectStroke:
+            draw_list->AddRect(part.Origin, part.Origin + key.Size, part.Color, key.Rounding, ImDrawFlags_None, key.Thickness);
+            break;
+        case ImGuiToggleMeshShape_CircleFilled:
+            draw_list->AddCircleFilled(part.Origin, key.Size.x, part.Color, key.CircleSegments);
+            break;
+        case ImGuiToggleMeshShape_CircleStroke:
+            draw_list->AddCircle(part.Origin, key.Size.x, part.Color, key.CircleSegments, key.Thickness);
+            break;
+        case ImGuiToggleMeshShape_RectShadow:
+        {
+            // without a shadow sprite, shadows are a stroke just outside the shape, as thick as the shadow.
+            const ImVec2 half_thickness(key.Thickness * 0.5f, key.Thickness * 0.5f);
+            draw_list->AddRect(part.Origin - half_thickness, part.Origin + key.Size + half_thickness, part.Color, key.Rounding, ImDrawFlags_None, key.Thickness);
+            break;
+        }
+        case ImGuiToggleMeshShape_CircleShadow:
+            draw_list->AddCircle(part.Origin, key.Size.x + key.Thickness * 0.5f, part.Color, key.CircleSegments, key.Thickness);
+            break;
+        default:
+            IM_ASSERT(false && "Unknown toggle mesh shape.");
+            break;
+        }
+    }
+
+    // copies a template into space already reserved in the draw list, moved to the origin and recolored.
+    void WriteTemplate(ImDrawList* draw_list, const ImGuiToggleMeshTemplate& mesh, const ImVec2& origin, ImU32 color)
+    {
+        ImGui::WriteToggleMesh(draw_list->_VtxWritePtr, draw_list->_IdxWritePtr, draw_list->_VtxCurrentIdx, mesh, origin, color);
+
+        draw_list->_IdxWritePtr += mesh.Indices.Size;
+        draw_list->_VtxWritePtr += mesh.Vertices.Size;
+        draw_list->_VtxCurrentIdx += mesh.Vertices.Size;
+    }
+
+    // copies what a shape drew into a draw list into a template, relative to its origin, with its colors turned into alpha masks.
+    void CopyToTemplate(ImGuiToggleMeshTemplate* mesh, const ImDrawList* draw_list, const ImVec2& origin, int vertex_start, int index_start, unsigned int vertex_index_start)
+    {
+        const int vertex_count = draw_list->VtxBuffer.Size - vertex_start;
+        const int index_count = draw_list->IdxBuffer.Size - index_start;
+
+        mesh->Vertices.resize(vertex_count);
+        mesh->Indices.resize(index_count);
+
+        for (int i = 0; i < vertex_count; ++i)
+        {
+            const ImDrawVert& vertex = draw_list->VtxBuffer[vertex_start + i];
+            mesh->Vertices[i].pos = vertex.pos - origin;
+            mesh->Vertices[i].uv = vertex.uv;
+            mesh->Vertices[i].col = (vertex.col & IM_COL32_A_MASK) != 0 ? IM_COL32_A_MASK : 0;
+        }
+
+        for (int i = 0; i < index_count; ++i)
+        {
+            mesh->Indices[i] = (ImDrawIdx)(draw_list->IdxBuffer[index_start + i] - vertex_index_start);
+        }
+    }
+} // namespace
+
+void ImGui::WriteToggleMesh(ImDrawVert* vertex_write, ImDrawIdx* index_write, unsigned int vertex_base, const ImGuiToggleMeshTemplate& mesh, const ImVec2& origin, ImU32 color)
+{
+    for (int i = 0; i < mesh.Indices.Size; ++i)
+    {
+        index_write[i] = (ImDrawIdx)(vertex_base + mesh.Indices[i]);
+    }
+
+    for (int i = 0; i < mesh.Vertices.Size; ++i)
+    {
+        const ImDrawVert& vertex = mesh.Vertices[i];
+        vertex_write[i].pos = vertex.pos + origin;
+        vertex_write[i].uv = vertex.uv;
+        vertex_write[i].col = color & (vertex.col | ~IM_COL32_A_MASK);
+    }
+}
+
+void ImGui::InitToggleMeshKey(ImGuiToggleMeshKey* key, const ImDrawList* draw_list, ImGuiToggleMeshShape shape, const ImVec2& size, float rounding /*= 0.0f*/, float thickness /*= 0.0f*/)
+{
+    // clear everything first, so the key can be hashed and compared as raw memory.
+    memset((void*)key, 0, sizeof(*key));
+
+    key->Shape = shape;
+    key->Size = size;
+    key->Rounding = rounding;
+    key->Thickness = thickness;
+    key->DrawListFlags = draw_list->Flags;
+    key->FringeScale = draw_list->_FringeScale;
+    key->CircleSegmentMaxError = draw_list->_Data->CircleSegmentMaxError;
+    key->TexUvWhitePixel = draw_list->_Data->TexUvWhitePixel;
+#if IMGUI_VERSION_NUM < 19200
+    key->TextureId = draw_list->_CmdHeader.TextureId;
+#endif
+}
+
+const ImGuiToggleMeshTemplate* ImGuiToggleMeshCache::Find(const ImGuiToggleMeshKey& key) const
+{
+    const int index = TemplateIndices.GetInt(::HashMeshKey(key), -1);
+    if (index < 0)
+    {
+        return nullptr;
+    }
+
+    const ImGuiToggleMeshTemplate& mesh = Templates[index];
+    return memcmp(&mesh.Key, &key, sizeof(key)) == 0 ? &mesh : nullptr;
+}
+
+void ImGuiToggleMeshCache::DrawParts(ImDrawList* draw_list, const ImGuiToggleMeshPart* parts, int part_count, bool allow_capture)
+{
+    const int max_parts = 4;
+    IM_ASSERT(part_count <= max_parts);
+
+    const ImGuiToggleMeshTemplate* meshes[max_parts];
+    int index_count = 0;
+    int vertex_count = 0;
+    bool all_cached = true;
+
+    for (int i = 0; i < part_count && all_cached; ++i)
+    {
+        meshes[i] = ::IsColorVisible(parts[i].Color) ? Find(parts[i].Key) : nullptr;
+        all_cached = meshes[i] != nullptr || !::IsColorVisible(parts[i].Color);
+
+        if (meshes[i] != nullptr)
+        {
+            index_count += meshes[i]->Indices.Size;
+            vertex_count += meshes[i]->Vertices.Size;
+        }
+    }
+
+    // if we've seen every part before, copy them all into the draw list in one go.
+    if (all_cached)
+    {
+        draw_list->PrimReserve(index_count, vertex_count);
+
+        for (int i = 0; i < part_count; ++i)
+        {
+            if (meshes[i] != nullptr)
+            {
+                ::WriteTemplate(draw_list, *meshes[i], parts[i].Origin, parts[i].Color);
+            }
+        }
+
+        return;
+    }
+
+    // otherwise, draw them the slow way, remembering what was drawn for next time.
+    for (int i = 0; i < part_count; ++i)
+    {
+        DrawAndCapture(draw_list, parts[i], allow_capture);
+    }
+}
+
+ImGuiToggleMeshCache::~ImGuiToggleMeshCache()
+{
+    Clear();
+
+    if (ScratchDrawList != nullptr)
+    {
+        IM_DELETE(ScratchDrawList);
+        ScratchDrawList = nullptr;
+    }
+}
+
+const ImGuiToggleMeshTemplate* ImGuiToggleMeshCache::FindOrCapture(const ImDrawList* like_draw_list, const ImGuiToggleMeshKey& key)
+{
+    const ImGuiToggleMeshTemplate* existing = Find(key);
+    if (existing != nullptr)
+    {
+        return existing;
+    }
+
+    if (Templates.Size >= ::MeshCacheCapacity)
+    {
+        Clear();
+    }
+
+    Templates.push_back(ImGuiToggleMeshTemplate());
+    ImGuiToggleMeshTemplate& mesh = Templates.back();
+    if (!Tessellate(&mesh, like_draw_list, key))
+    {
+        Templates.pop_back();
+        return nullptr;
+    }
+
+    TemplateIndices.SetInt(::HashMeshKey(key), Templates.Size - 1);
+    return &mesh;
+}
+
+bool ImGuiToggleMeshCache::Tessellate(ImGuiToggleMeshTemplate* mesh, const ImDrawList* like_draw_list, const ImGuiToggleMeshKey& key)
+{
+    if (Sprites != nullptr && ImGui::BuildToggleSpriteMesh(mesh, *Sprites, key))
+    {
+        return true;
+    }
+
+    if (ScratchDrawList == nullptr || ScratchDrawList->_Data != like_draw_list->_Data)
+    {
+        if (ScratchDrawList != nullptr)
+        {
+            IM_DELETE(ScratchDrawList);
+        }
+
+        ScratchDrawList = IM_NEW(ImDrawList)(like_draw_list->_Data);
+    }
+
+    // tessellate just like the real draw list would.
+    ImDrawList* draw_list = ScratchDrawList;
+    draw_list->_ResetForNewFrame();
+    draw_list->Flags = like_draw_list->Flags;
+    draw_list->_FringeScale = like_draw_list->_FringeScale;
+
+    ImGuiToggleMeshPart part;
+    part.Key = key;
+    part.Origin = ImVec2(0.0f, 0.0f);
+    part.Color = IM_COL32_WHITE;
+    ::DrawPart(draw_list, part);
+
+    if (draw_list->VtxBuffer.Size == 0)
+    {
+        return false;
+    }
+
+    mesh->Key = key;
+    ::CopyToTemplate(mesh, draw_list, part.Origin, 0, 0, 0);
+    return true;
+}
+
+void ImGuiToggleMeshCache::Clear()
+{
+    for (int i = 0; i < Templates.Size; ++i)
+    {
+        Templates[i].Vertices.clear();
+        Templates[i].Indices.clear();
+    }
+
+    SpriteTemplate.Vertices.clear();
+    SpriteTemplate.Indices.clear();
+
+    Templates.resize(0);
+    TemplateIndices.Data.resize(0);
+}
+
+void ImGuiToggleMeshCache::DrawAndCapture(ImDrawList* draw_list, const ImGuiToggleMeshPart& part, bool allow_capture)
+{
+    // invisible shapes aren't drawn at all, so there is nothing to capture.
+    if (!::IsColorVisible(part.Color))
+    {
+        return;
+    }
+
+    const ImGuiToggleMeshTemplate* existing = Find(part.Key);
+    if (existing != nullptr)
+    {
+        draw_list->PrimReserve(existing->Indices.Size, existing->Vertices.Size);
+        ::WriteTemplate(draw_list, *existing, part.Origin, part.Color);
+        return;
+    }
+
+    // shapes with a sprite are built as a few textured quads, rather than drawn and captured.
+    if (Sprites != nullptr)
+    {
+        if (allow_capture && Templates.Size >= ::MeshCacheCapacity)
+        {
+            Clear();
+        }
+
+        ImGuiToggleMeshTemplate* mesh = &SpriteTemplate;
+        if (allow_capture)
+        {
+            Templates.push_back(ImGuiToggleMeshTemplate());
+            mesh = &Templates.back();
+        }
+
+        if (ImGui::BuildToggleSpriteMesh(mesh, *Sprites, part.Key))
+        {
+            if (allow_capture)
+            {
+                TemplateIndices.SetInt(::HashMeshKey(part.Key), Templates.Size - 1);
+            }
+
+            draw_list->PrimReserve(mesh->Indices.Size, mesh->Vertices.Size);
+            ::WriteTemplate(draw_list, *mesh, part.Origin, part.Color);
+            return;
+        }
+
+        if (allow_capture)
+        {
+            Templates.pop_back();
+        }
+    }
+
+    const int vertex_start = draw_list->VtxBuffer.Size;
+    const int index_start = draw_list->IdxBuffer.Size;
+    const unsigned int vertex_index_start = draw_list->_VtxCurrentIdx;
+
+    ::DrawPart(draw_list, part);
+
+    const int vertex_count = draw_list->VtxBuffer.Size - vertex_start;
+
+    // if the draw list had to start a new command to fit the shape, the indices aren't relative to where we started, so skip it.
+    if (!allow_capture || vertex_count <= 0 || draw_list->_VtxCurrentIdx != vertex_index_start + vertex_count)
+    {
+        return;
+    }
+
+    if (Templates.Size >= ::MeshCacheCapacity)
+    {
+        Clear();
+    }
+
+    TemplateIndices.SetInt(::HashMeshKey(part.Key), Templates.Size);
+    Templates.push_back(ImGuiToggleMeshTemplate());
+
+    ImGuiToggleMeshTemplate& mesh = Templates.back();
+    mesh.Key = part.Key;
+    ::CopyToTemplate(&mesh, draw_list, part.Origin, vertex_start, index_start, vertex_index_start);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif // IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+
+struct ImGuiToggleSpriteAtlas;
+
+// ImGuiToggleMeshShape: The shapes a toggle is drawn with.
+enum ImGuiToggleMeshShape
+{
+    ImGuiToggleMeshShape_RectFilled,        // A filled, optionally rounded, rectangle. Used for frames and rectangular knobs.
+    ImGuiToggleMeshShape_RectStroke,        // An outlined, optionally rounded, rectangle. Used for frame and knob borders.
+    ImGuiToggleMeshShape_CircleFilled,      // A filled circle. Used for circular knobs.
+    ImGuiToggleMeshShape_CircleStroke,      // An outlined circle. Used for circular knob borders.
+    ImGuiToggleMeshShape_RectShadow,        // A shadow `Thickness` wide around the outside of a rectangle. Used for frame and rectangular knob shadows.
+    ImGuiToggleMeshShape_CircleShadow,      // A shadow `Thickness` wide around the outside of a circle. Used for circular knob shadows.
+};
+
+// ImGuiToggleMeshKey: Everything that changes the geometry of a shape, other than its position.
+struct ImGuiToggleMeshKey
+{
+    ImGuiToggleMeshShape Shape;
+    ImVec2 Size;                            // The size of a rectangle, or the radius of a circle in `x`.
+    float Rounding;
+    float Thickness;
+    int CircleSegments;                     // The number of segments a circle is drawn with, or 0 to let the draw list choose.
+
+    // draw list settings that change tessellation.
+    ImDrawListFlags DrawListFlags;
+    float FringeScale;
+    float CircleSegmentMaxError;
+    ImVec2 TexUvWhitePixel;
+    ImTextureID TextureId;
+};
+
+// ImGuiToggleMeshPart: A single shape to draw, with where and in what color to draw it.
+struct ImGuiToggleMeshPart
+{
+    ImGuiToggleMeshKey Key;
+    ImVec2 Origin;                          // The top left of a rectangle, or the center of a circle.
+    ImU32 Color;
+};
+
+// ImGuiToggleMeshTemplate: The vertices and indices of a tessellated shape, relative to its origin.
+//   Each vertex color holds only an alpha mask, so the template can be recolored: opaque for solid vertices, and zero for anti-aliased fringes.
+struct ImGuiToggleMeshTemplate
+{
+    ImGuiToggleMeshKey Key;
+    ImVector<ImDrawVert> Vertices;
+    ImVector<ImDrawIdx> Indices;
+};
+
+// ImGuiToggleMeshCache: Meshes of the shapes toggles are drawn with, tessellated once and then copied into the draw list.
+struct ImGuiToggleMeshCache
+{
+    ImVector<ImGuiToggleMeshTemplate> Templates;
+    ImGuiStorage TemplateIndices;
+    ImDrawList* ScratchDrawList = nullptr;  // Shapes are tessellated into this when they aren't being drawn at the same time.
+    const ImGuiToggleSpriteAtlas* Sprites = nullptr; // When set, round shapes are built from baked sprites instead of being tessellated.
+    ImGuiToggleMeshTemplate SpriteTemplate; // Sprite meshes that aren't remembered are built into this.
+
+    ~ImGuiToggleMeshCache();
+
+    const ImGuiToggleMeshTemplate* Find(const ImGuiToggleMeshKey& key) const;
+    void DrawParts(ImDrawList* draw_list, const ImGuiToggleMeshPart* parts, int part_count, bool allow_capture);
+
+    // Finds a shape's template, tessellating and remembering it if it's new. May clear the cache, so earlier results are only valid until it is called again.
+    const ImGuiToggleMeshTemplate* FindOrCapture(const ImDrawList* like_draw_list, const ImGuiToggleMeshKey& key);
+
+    // Tessellates a shape into `mesh` without remembering it, as `like_draw_list` would draw it, or builds it from a sprite if there is one. Returns false if nothing was drawn.
+    bool Tessellate(ImGuiToggleMeshTemplate* mesh, const ImDrawList* like_draw_list, const ImGuiToggleMeshKey& key);
+
+    void Clear();
+
+private:
+    void DrawAndCapture(ImDrawList* draw_list, const ImGuiToggleMeshPart& part, bool allow_capture);
+};
+
+namespace ImGui
+{
+    // Fills out the tessellation settings of a mesh key from the draw list it will be drawn in.
+    void InitToggleMeshKey(ImGuiToggleMeshKey* key, const ImDrawList* draw_list, ImGuiToggleMeshShape shape, const ImVec2& size, float rounding = 0.0f, float thickness = 0.0f);
+
+    // Writes a template, moved to `origin` and recolored, into vertex and index memory that has already been reserved.
+    // `vertex_base` is the draw list vertex index of the first vertex written. Uses no ImGui state, so it can run on any thread.
+    void WriteToggleMesh(ImDrawVert* vertex_write, ImDrawIdx* index_write, unsigned int vertex_base, const ImGuiToggleMeshTemplate& mesh, const ImVec2& origin, ImU32 color);
+}
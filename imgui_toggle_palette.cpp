@@ -7,9 +7,71 @@
 
 #include "imgui.h"
 
+// blend palettes with SSE2 or NEON when the target has them. define IMGUI_TOGGLE_DISABLE_SIMD (or IMGUI_DISABLE_SSE) to always use plain C++.
+#if !defined(IMGUI_TOGGLE_DISABLE_SIMD) && !defined(IMGUI_DISABLE_SSE) && (defined(__SSE2__) || defined(__x86_64__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_TOGGLE_ENABLE_SSE2
+#include <emmintrin.h>
+#elif !defined(IMGUI_TOGGLE_DISABLE_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64))
+#define IMGUI_TOGGLE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
 
 using namespace ImGuiToggleMath;
 
+namespace
+{
+    // the theme colors read by `ImGui::UnionPalette()`, which resolved palettes depend on.
+    const ImGuiCol PaletteStyleColors[ImGuiTogglePaletteCache::StyleColorCount] =
+    {
+        ImGuiCol_Text,
+        ImGuiCol_FrameBg,
+        ImGuiCol_FrameBgHovered,
+        ImGuiCol_Button,
+        ImGuiCol_ButtonHovered,
+        ImGuiCol_Border,
+        ImGuiCol_BorderShadow,
+    };
+
+    // the most entries the palette cache will hold before starting over.
+    // palettes are usually static, so this is only reached if palettes are created on the fly.
+    const int PaletteCacheCapacity = 256;
+
+    inline ImU32 PackColor(const ImVec4& color, float alpha)
+    {
+        return ImGui::ColorConvertFloat4ToU32(ImVec4(color.x, color.y, color.z, color.w * alpha));
+    }
+
+    inline bool CandidateContentsMatch(const ImGuiTogglePalette* candidate, const ImGuiTogglePalette& contents)
+    {
+        return candidate == nullptr || memcmp(candidate, &contents, sizeof(ImGuiTogglePalette)) == 0;
+    }
+
+    // the resolved palette is blended as an array of packed colors.
+    const int ResolvedPaletteColorCount = 9;
+    static_assert(sizeof(ImGuiToggleResolvedPalette) == sizeof(ImU32) * ResolvedPaletteColorCount, "ImGuiToggleResolvedPalette must only hold packed colors.");
+
+#if defined(IMGUI_TOGGLE_ENABLE_SSE2)
+    // lerps each 8-bit channel of four packed colors, with the same weights and rounding as `ImLerpColorU32()`.
+    // channels are widened to 16 bits, where `channel * weight` is at most 255 * 256, so neither the multiply nor the sum can overflow.
+    inline __m128i LerpColorsU32x4(__m128i a, __m128i b, __m128i weight_a, __m128i weight_b)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i low = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), weight_a), _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), weight_b)), 8);
+        const __m128i high = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), weight_a), _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), weight_b)), 8);
+        return _mm_packus_epi16(low, high);
+    }
+#elif defined(IMGUI_TOGGLE_ENABLE_NEON)
+    // lerps each 8-bit channel of four packed colors, with the same weights and rounding as `ImLerpColorU32()`.
+    inline uint8x16_t LerpColorsU32x4(uint8x16_t a, uint8x16_t b, uint16x8_t weight_a, uint16x8_t weight_b)
+    {
+        const uint16x8_t low = vshrq_n_u16(vmlaq_u16(vmulq_u16(vmovl_u8(vget_low_u8(a)), weight_a), vmovl_u8(vget_low_u8(b)), weight_b), 8);
+        const uint16x8_t high = vshrq_n_u16(vmlaq_u16(vmulq_u16(vmovl_u8(vget_high_u8(a)), weight_a), vmovl_u8(vget_high_u8(b)), weight_b), 8);
+        return vcombine_u8(vmovn_u16(low), vmovn_u16(high));
+    }
+#endif
+} // namespace
+
 void ImGui::UnionPalette(ImGuiTogglePalette* target, const ImGuiTogglePalette* candidate, const ImVec4 colors[], bool v)
 {
 
@@ -83,3 +145,198 @@ void ImGui::BlendPalettes(ImGuiTogglePalette* result, const ImGuiTogglePalette&
 
 #undef BLEND_PALETTES_LERP
 }
+
+void ImGui::ResolvePalette(ImGuiToggleResolvedPalette* target, const ImGuiTogglePalette* candidate, const ImGuiStyle& style, bool v)
+{
+    ImGuiTogglePalette unioned;
+    UnionPalette(&unioned, candidate, style.Colors, v);
+
+    target->Knob = ::PackColor(unioned.Knob, style.Alpha);
+    target->KnobHover = ::PackColor(unioned.KnobHover, style.Alpha);
+    target->Frame = ::PackColor(unioned.Frame, style.Alpha);
+    target->FrameHover = ::PackColor(unioned.FrameHover, style.Alpha);
+    target->FrameBorder = ::PackColor(unioned.FrameBorder, style.Alpha);
+    target->FrameShadow = ::PackColor(unioned.FrameShadow, style.Alpha);
+    target->KnobBorder = ::PackColor(unioned.KnobBorder, style.Alpha);
+    target->KnobShadow = ::PackColor(unioned.KnobShadow, style.Alpha);
+    target->A11yGlyph = ::PackColor(unioned.A11yGlyph, style.Alpha);
+}
+
+void ImGui::BlendResolvedPalettes(ImGuiToggleResolvedPalette* result, const ImGuiToggleResolvedPalette& a, const ImGuiToggleResolvedPalette& b, float blend_amount)
+{
+    // a quick out for if we are at either end of the blend.
+    if (ImApproximately(blend_amount, 0.0f))
+    {
+        *result = a;
+        return;
+    }
+    else if (ImApproximately(blend_amount, 1.0f))
+    {
+        *result = b;
+        return;
+    }
+
+#define BLEND_RESOLVED_PALETTES_LERP(member) \
+    do { \
+        result->member = ImLerpColorU32(a.member, b.member, blend_amount); \
+    } while (0)
+
+    BLEND_RESOLVED_PALETTES_LERP(Knob);
+    BLEND_RESOLVED_PALETTES_LERP(KnobHover);
+    BLEND_RESOLVED_PALETTES_LERP(Frame);
+    BLEND_RESOLVED_PALETTES_LERP(FrameHover);
+    BLEND_RESOLVED_PALETTES_LERP(FrameBorder);
+    BLEND_RESOLVED_PALETTES_LERP(FrameShadow);
+    BLEND_RESOLVED_PALETTES_LERP(KnobBorder);
+    BLEND_RESOLVED_PALETTES_LERP(KnobShadow);
+    BLEND_RESOLVED_PALETTES_LERP(A11yGlyph);
+
+#undef BLEND_RESOLVED_PALETTES_LERP
+}
+
+void ImGui::BlendResolvedPalettesN(ImGuiToggleResolvedPalette* results, const ImGuiToggleResolvedPalette& a, const ImGuiToggleResolvedPalette& b, const float* blend_amounts, int count)
+{
+    const ImU32* colors_a = reinterpret_cast<const ImU32*>(&a);
+    const ImU32* colors_b = reinterpret_cast<const ImU32*>(&b);
+
+    // every result blends the same pair of palettes, so load them once.
+#if defined(IMGUI_TOGGLE_ENABLE_SSE2)
+    const __m128i a_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors_a));
+    const __m128i a_second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors_a + 4));
+    const __m128i b_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors_b));
+    const __m128i b_second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors_b + 4));
+#elif defined(IMGUI_TOGGLE_ENABLE_NEON)
+    const uint8x16_t a_first = vld1q_u8(reinterpret_cast<const uint8_t*>(colors_a));
+    const uint8x16_t a_second = vld1q_u8(reinterpret_cast<const uint8_t*>(colors_a + 4));
+    const uint8x16_t b_first = vld1q_u8(reinterpret_cast<const uint8_t*>(colors_b));
+    const uint8x16_t b_second = vld1q_u8(reinterpret_cast<const uint8_t*>(colors_b + 4));
+#endif
+
+    for (int i = 0; i < count; ++i)
+    {
+        const float blend_amount = blend_amounts[i];
+
+        // the same quick outs as `BlendResolvedPalettes()`, so both give the same results.
+        if (ImApproximately(blend_amount, 0.0f))
+        {
+            results[i] = a;
+            continue;
+        }
+        else if (ImApproximately(blend_amount, 1.0f))
+        {
+            results[i] = b;
+            continue;
+        }
+
+        ImU32* colors_result = reinterpret_cast<ImU32*>(&results[i]);
+
+#if defined(IMGUI_TOGGLE_ENABLE_SSE2) || defined(IMGUI_TOGGLE_ENABLE_NEON)
+        // the first eight colors are lerped four at a time, and the ninth on its own.
+        const ImU32 weight_b = (ImU32)(ImSaturate(blend_amount) * 256.0f);
+        const ImU32 weight_a = 256 - weight_b;
+#if defined(IMGUI_TOGGLE_ENABLE_SSE2)
+        const __m128i weights_a = _mm_set1_epi16((short)weight_a);
+        const __m128i weights_b = _mm_set1_epi16((short)weight_b);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(colors_result), ::LerpColorsU32x4(a_first, b_first, weights_a, weights_b));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(colors_result + 4), ::LerpColorsU32x4(a_second, b_second, weights_a, weights_b));
+#else
+        const uint16x8_t weights_a = vdupq_n_u16((uint16_t)weight_a);
+        const uint16x8_t weights_b = vdupq_n_u16((uint16_t)weight_b);
+        vst1q_u8(reinterpret_cast<uint8_t*>(colors_result), ::LerpColorsU32x4(a_first, b_first, weights_a, weights_b));
+        vst1q_u8(reinterpret_cast<uint8_t*>(colors_result + 4), ::LerpColorsU32x4(a_second, b_second, weights_a, weights_b));
+#endif
+        colors_result[8] = ImLerpColorU32(colors_a[8], colors_b[8], blend_amount);
+#else
+        for (int color = 0; color < ::ResolvedPaletteColorCount; ++color)
+        {
+            colors_result[color] = ImLerpColorU32(colors_a[color], colors_b[color], blend_amount);
+        }
+#endif
+    }
+}
+
+const ImGuiTogglePaletteCacheEntry& ImGuiTogglePaletteCache::Resolve(const ImGuiTogglePalette* on_candidate, const ImGuiTogglePalette* off_candidate, const ImGuiStyle& style)
+{
+    UpdateStyleGeneration(style);
+
+    // neighboring toggles usually share palettes, so try the last entry used before searching.
+    ImGuiTogglePaletteCacheEntry* entry = nullptr;
+    if (LastEntryIndex >= 0
+        && Entries[LastEntryIndex].OnCandidate == on_candidate
+        && Entries[LastEntryIndex].OffCandidate == off_candidate)
+    {
+        entry = &Entries[LastEntryIndex];
+    }
+    else
+    {
+        const void* candidates[2] = { on_candidate, off_candidate };
+        const ImGuiID key = ImHashData(candidates, sizeof(candidates));
+        int index = EntryIndices.GetInt(key, -1);
+
+        if (index < 0)
+        {
+            if (Entries.Size >= ::PaletteCacheCapacity)
+            {
+                Clear();
+            }
+
+            index = Entries.Size;
+            Entries.push_back(ImGuiTogglePaletteCacheEntry());
+            EntryIndices.SetInt(key, index);
+            Entries[index].StyleGeneration = -1;
+        }
+
+        entry = &Entries[index];
+        LastEntryIndex = index;
+    }
+
+    // re-resolve if this is a new entry (or a hash collision), the style has changed, or the user changed a candidate.
+    const bool is_stale = entry->OnCandidate != on_candidate
+        || entry->OffCandidate != off_candidate
+        || entry->StyleGeneration != StyleGeneration
+        || !::CandidateContentsMatch(on_candidate, entry->OnCandidateContents)
+        || !::CandidateContentsMatch(off_candidate, entry->OffCandidateContents);
+
+    if (is_stale)
+    {
+        entry->OnCandidate = on_candidate;
+        entry->OffCandidate = off_candidate;
+        entry->OnCandidateContents = on_candidate != nullptr ? *on_candidate : ImGuiTogglePalette();
+        entry->OffCandidateContents = off_candidate != nullptr ? *off_candidate : ImGuiTogglePalette();
+        entry->StyleGeneration = StyleGeneration;
+        ImGui::ResolvePalette(&entry->On, on_candidate, style, true);
+        ImGui::ResolvePalette(&entry->Off, off_candidate, style, false);
+    }
+
+    return *entry;
+}
+
+void ImGuiTogglePaletteCache::Clear()
+{
+    Entries.resize(0);
+    EntryIndices.Data.resize(0);
+    LastEntryIndex = -1;
+}
+
+void ImGuiTogglePaletteCache::UpdateStyleGeneration(const ImGuiStyle& style)
+{
+    bool is_style_changed = StyleAlpha != style.Alpha;
+
+    for (int i = 0; i < StyleColorCount && !is_style_changed; ++i)
+    {
+        is_style_changed = memcmp(&StyleColors[i], &style.Colors[::PaletteStyleColors[i]], sizeof(ImVec4)) != 0;
+    }
+
+    if (!is_style_changed)
+    {
+        return;
+    }
+
+    for (int i = 0; i < StyleColorCount; ++i)
+    {
+        StyleColors[i] = style.Colors[::PaletteStyleColors[i]];
+    }
+
+    StyleAlpha = style.Alpha;
+    ++StyleGeneration;
+}
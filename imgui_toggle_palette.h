@@ -34,8 +34,68 @@ struct ImGuiTogglePalette
     ImVec4 A11yGlyph;
 };
 
+// ImGuiToggleResolvedPalette: A palette with theme colors filled in, packed with the style alpha applied, ready to draw with.
+struct ImGuiToggleResolvedPalette
+{
+    ImU32 Knob;
+    ImU32 KnobHover;
+    ImU32 Frame;
+    ImU32 FrameHover;
+    ImU32 FrameBorder;
+    ImU32 FrameShadow;
+    ImU32 KnobBorder;
+    ImU32 KnobShadow;
+    ImU32 A11yGlyph;
+};
+
+// ImGuiTogglePaletteCacheEntry: The resolved on and off palettes for a pair of palette candidates.
+struct ImGuiTogglePaletteCacheEntry
+{
+    // The candidates this entry was resolved for.
+    const ImGuiTogglePalette* OnCandidate;
+    const ImGuiTogglePalette* OffCandidate;
+
+    // Copies of the candidates' contents when they were resolved, to notice when the user changes them.
+    ImGuiTogglePalette OnCandidateContents;
+    ImGuiTogglePalette OffCandidateContents;
+
+    // The style generation of the cache when this entry was resolved.
+    int StyleGeneration;
+
+    // The resolved palettes.
+    ImGuiToggleResolvedPalette On;
+    ImGuiToggleResolvedPalette Off;
+};
+
+// ImGuiTogglePaletteCache: Remembers resolved palettes for on/off candidate pairs, so they don't need to be resolved for every toggle, every frame.
+//   The style colors palettes are resolved against are compared on each lookup, and any change starts a new style generation.
+struct ImGuiTogglePaletteCache
+{
+    ImVector<ImGuiTogglePaletteCacheEntry> Entries;
+    ImGuiStorage EntryIndices;
+    int LastEntryIndex = -1;
+
+    // The style values the current style generation was resolved against.
+    static constexpr int StyleColorCount = 7;
+    ImVec4 StyleColors[StyleColorCount];
+    float StyleAlpha = 0.0f;
+    int StyleGeneration = 0;
+
+    const ImGuiTogglePaletteCacheEntry& Resolve(const ImGuiTogglePalette* on_candidate, const ImGuiTogglePalette* off_candidate, const ImGuiStyle& style);
+    void Clear();
+
+private:
+    void UpdateStyleGeneration(const ImGuiStyle& style);
+};
+
 namespace ImGui
 {
     void UnionPalette(ImGuiTogglePalette* target, const ImGuiTogglePalette* candidate, const ImVec4 colors[], bool v);
     void BlendPalettes(ImGuiTogglePalette* result, const ImGuiTogglePalette& a, const ImGuiTogglePalette& b, float blend_amount);
+    void ResolvePalette(ImGuiToggleResolvedPalette* target, const ImGuiTogglePalette* candidate, const ImGuiStyle& style, bool v);
+    void BlendResolvedPalettes(ImGuiToggleResolvedPalette* result, const ImGuiToggleResolvedPalette& a, const ImGuiToggleResolvedPalette& b, float blend_amount);
+
+    // blends the same pair of palettes by `count` amounts at once, using SSE2 or NEON when available.
+    // gives exactly the same results as calling `BlendResolvedPalettes()` for each amount.
+    void BlendResolvedPalettesN(ImGuiToggleResolvedPalette* results, const ImGuiToggleResolvedPalette& a, const ImGuiToggleResolvedPalette& b, const float* blend_amounts, int count);
 }
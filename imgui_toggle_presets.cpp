@@ -1,4 +1,5 @@
 #include "imgui_toggle_presets.h"
+#include "imgui_toggle_context.h"
 #include "imgui_toggle_palette.h"
 
 namespace
@@ -11,208 +12,394 @@ namespace
     const ImVec4 GreenHighlight(0.3f, 1.0f, 0.0f, 0.75f);
     const ImVec4 RedHighlight(1.0f, 0.3f, 0.0f, 0.75f);
 
+    // the presets that scale with the font size, and so are built per context.
+    enum ScaledPreset
+    {
+        ScaledPreset_iOS,
+        ScaledPreset_Material,
+        ScaledPreset_Minecraft,
+    };
+
+    typedef void (*BuildPresetFunction)(ImGuiToggleConfig* config, float size_scale, bool light_mode);
+
+    // how many frames a scaled preset can go unused before it's evicted. this is also how often the cache checks for them.
+    const int PresetCacheEvictionFrames = 60;
+
     // DPI aware scale utility: the scale should proportional to the font size
     // font Size is typically 14.5 on normal DPI screens, and 29 on windows HighDPI
-    float DpiFactor()
+    float DpiFactor(float font_size)
+    {
+        return font_size / 14.5f;
+    }
+
+    // hashes each field on its own, so padding between them is never read.
+    ImGuiID HashPresetKey(const ImGuiTogglePresetKey& key)
     {
-        return ImGui::GetFontSize() / 14.5f;
+        ImGuiID hash = ImHashData(&key.Preset, sizeof(key.Preset));
+        hash = ImHashData(&key.SizeScale, sizeof(key.SizeScale), hash);
+        hash = ImHashData(&key.LightMode, sizeof(key.LightMode), hash);
+        return ImHashData(&key.FontSize, sizeof(key.FontSize), hash);
     }
+
+    inline bool PresetKeysEqual(const ImGuiTogglePresetKey& a, const ImGuiTogglePresetKey& b)
+    {
+        return a.Preset == b.Preset && a.SizeScale == b.SizeScale && a.LightMode == b.LightMode && a.FontSize == b.FontSize;
+    }
+
+    // stores an entry at its hash, or the first free key after it when presets share a hash.
+    void InsertPresetEntry(ImGuiStorage& entry_indices, ImGuiTogglePresetCacheEntry* entry)
+    {
+        ImGuiID index = ::HashPresetKey(entry->Key);
+        while (entry_indices.GetVoidPtr(index) != nullptr)
+        {
+            ++index;
+        }
+
+        entry_indices.SetVoidPtr(index, entry);
+    }
+
+    // gets a preset from the current context's preset cache, building it the first time it's asked for at this scale and font size.
+    const ImGuiToggleConfig& GetScaledPreset(ScaledPreset preset, float size_scale, bool light_mode, BuildPresetFunction build)
+    {
+        ImGuiContext& g = *GImGui;
+        ImGuiTogglePresetCache& presets = ImGui::GetToggleContext()->PresetCache;
+
+        ImGuiTogglePresetKey key;
+        key.Preset = preset;
+        key.SizeScale = size_scale;
+        key.LightMode = light_mode;
+        key.FontSize = g.FontSize;
+
+        ImGuiTogglePresetCacheEntry* entry = presets.Find(key);
+        if (entry == nullptr)
+        {
+            entry = presets.Add(key);
+            build(&entry->Config, size_scale * ::DpiFactor(key.FontSize), light_mode);
+        }
+
+        entry->LastFrameUsed = g.FrameCount;
+        return entry->Config;
+    }
+
+    ImGuiTogglePalette MakeGlowingPalette(const ImVec4& glow)
+    {
+        ImGuiTogglePalette palette;
+        palette.FrameShadow = glow;
+        palette.KnobShadow = glow;
+        return palette;
+    }
+
+    ImGuiToggleConfig MakeRectangleStyle()
+    {
+        ImGuiToggleConfig config;
+        config.Flags |= ImGuiToggleFlags_Animated;
+        config.FrameRounding = 0.1f;
+        config.KnobRounding = 0.3f;
+        config.AnimationDuration = 0.5f;
+
+        return config;
+    }
+
+    ImGuiToggleConfig MakeGlowingStyle()
+    {
+        static const ImGuiTogglePalette palette_on = ::MakeGlowingPalette(::GreenHighlight);
+        static const ImGuiTogglePalette palette_off = ::MakeGlowingPalette(::RedHighlight);
+
+        ImGuiToggleConfig config;
+        config.Flags |= ImGuiToggleFlags_Animated | ImGuiToggleFlags_Shadowed;
+        config.On.Palette = &palette_on;
+        config.Off.Palette = &palette_off;
+
+        return config;
+    }
+
+    void BuildiOSStyle(ImGuiToggleConfig* config, float size_scale, bool light_mode);
+    void BuildMaterialStyle(ImGuiToggleConfig* config, float size_scale, bool light_mode);
+    void BuildMinecraftStyle(ImGuiToggleConfig* config, float size_scale, bool light_mode);
 } // namespace
 
-ImGuiToggleConfig ImGuiTogglePresets::DefaultStyle()
+ImGuiTogglePresetCacheEntry* ImGuiTogglePresetCache::Find(const ImGuiTogglePresetKey& key) const
 {
-    return ImGuiToggleConfig();
+    // presets that share a hash are stored at the keys following it, up to the first free key.
+    for (ImGuiID index = ::HashPresetKey(key); ; ++index)
+    {
+        ImGuiTogglePresetCacheEntry* entry = static_cast<ImGuiTogglePresetCacheEntry*>(EntryIndices.GetVoidPtr(index));
+        if (entry == nullptr || ::PresetKeysEqual(entry->Key, key))
+        {
+            return entry;
+        }
+    }
 }
 
-ImGuiToggleConfig ImGuiTogglePresets::RectangleStyle()
+ImGuiTogglePresetCacheEntry* ImGuiTogglePresetCache::Add(const ImGuiTogglePresetKey& key)
 {
-    ImGuiToggleConfig config;
-    config.Flags |= ImGuiToggleFlags_Animated;
-    config.FrameRounding = 0.1f;
-    config.KnobRounding = 0.3f;
-    config.AnimationDuration = 0.5f;
+    ImGuiTogglePresetCacheEntry* entry = IM_NEW(ImGuiTogglePresetCacheEntry)();
+    entry->Key = key;
+    entry->LastFrameUsed = 0;
+    Entries.push_back(entry);
+    ::InsertPresetEntry(EntryIndices, entry);
+    return entry;
+}
 
-    return config;
+void ImGuiTogglePresetCache::EvictUnused(int frame_count)
+{
+    if (frame_count - LastEvictionFrame < ::PresetCacheEvictionFrames)
+    {
+        return;
+    }
+
+    LastEvictionFrame = frame_count;
+
+    // compact the presets that are still in use to the front.
+    int kept_count = 0;
+    for (int i = 0; i < Entries.Size; ++i)
+    {
+        ImGuiTogglePresetCacheEntry* entry = Entries[i];
+        if (frame_count - entry->LastFrameUsed >= ::PresetCacheEvictionFrames)
+        {
+            IM_DELETE(entry);
+            continue;
+        }
+
+        Entries[kept_count++] = entry;
+    }
+
+    if (kept_count == Entries.Size)
+    {
+        return;
+    }
+
+    // add the kept presets back, as a preset stored past its hash may need to move back into an evicted one's place.
+    Entries.resize(kept_count);
+    EntryIndices.Clear();
+    for (int i = 0; i < kept_count; ++i)
+    {
+        ::InsertPresetEntry(EntryIndices, Entries[i]);
+    }
 }
 
-ImGuiToggleConfig ImGuiTogglePresets::GlowingStyle()
+void ImGuiTogglePresetCache::Clear()
 {
-    static ImGuiTogglePalette palette_on;
-    palette_on.FrameShadow = ::GreenHighlight;
-    palette_on.KnobShadow = ::GreenHighlight;
+    for (int i = 0; i < Entries.Size; ++i)
+    {
+        IM_DELETE(Entries[i]);
+    }
 
-    static ImGuiTogglePalette palette_off;
-    palette_off.FrameShadow = ::RedHighlight;
-    palette_off.KnobShadow = ::RedHighlight;
+    Entries.clear();
+    EntryIndices.Clear();
+}
 
-    ImGuiToggleConfig config;
-    config.Flags |= ImGuiToggleFlags_Animated | ImGuiToggleFlags_Shadowed;
-    config.On.Palette = &palette_on;
-    config.Off.Palette = &palette_off;
+ImGuiToggleConfig ImGuiTogglePresets::DefaultStyle()
+{
+    static const ImGuiToggleConfig config;
+    return config;
+}
 
+ImGuiToggleConfig ImGuiTogglePresets::RectangleStyle()
+{
+    static const ImGuiToggleConfig config = ::MakeRectangleStyle();
     return config;
 }
 
+ImGuiToggleConfig ImGuiTogglePresets::GlowingStyle()
+{
+    static const ImGuiToggleConfig config = ::MakeGlowingStyle();
+    return config;
+}
 
-ImGuiToggleConfig ImGuiTogglePresets::iOSStyle(const float _size_scale /*= 1.0f*/, bool light_mode /*= false*/)
+ImGuiToggleConfig ImGuiTogglePresets::iOSStyle(float size_scale /*= 1.0f*/, bool light_mode /*= false*/)
 {
-    float size_scale = _size_scale * DpiFactor();
-
-    const ImVec4 frame_on(0.3f, 0.85f, 0.39f, 1.0f);
-    const ImVec4 frame_on_hover(0.0f, 1.0f, 0.57f, 1.0f);
-    const ImVec4 dark_mode_frame_off(0.22f, 0.22f, 0.24f, 1.0f);
-    const ImVec4 light_mode_frame_off(0.91f, 0.91f, 0.92f, 1.0f);
-    const ImVec4 dark_mode_frame_off_hover(0.4f, 0.4f, 0.4f, 1.0f);
-    const ImVec4 light_mode_frame_off_hover(0.7f, 0.7f, 0.7f, 1.0f);
-    const ImVec4 light_gray(0.89f, 0.89f, 0.89f, 1.0f);
-    const ImVec4 a11y_glyph_on(1.0f, 1.0f, 1.0f, 1.0f);
-    const ImVec4 a11y_glyph_off(0.4f, 0.4f, 0.4f, 1.0f);
-
-    const float ios_width = 153 * size_scale;
-    const float ios_height = 93 * size_scale;
-    const float ios_frame_border_thickness = 0.0f * size_scale;
-    const float ios_border_thickness = 0.0f * size_scale;
-    const float ios_offset = 0.0f * size_scale;
-    const float ios_inset = 6.0f * size_scale;
-
-    // setup 'on' colors
-    static ImGuiTogglePalette ios_palette_on;
-    ios_palette_on.Knob = ::White;
-    ios_palette_on.Frame = frame_on;
-    ios_palette_on.FrameHover = frame_on_hover;
-    ios_palette_on.KnobBorder = light_gray;
-    ios_palette_on.FrameBorder = light_gray;
-    ios_palette_on.A11yGlyph = a11y_glyph_on;
-
-    // setup 'off' colors
-    static ImGuiTogglePalette ios_palette_off;
-    ios_palette_off.Knob = ::White;
-    ios_palette_off.Frame = light_mode ? light_mode_frame_off : dark_mode_frame_off;
-    ios_palette_off.FrameHover = light_mode ? light_mode_frame_off_hover : light_mode_frame_off_hover;
-    ios_palette_off.KnobBorder = light_gray;
-    ios_palette_off.FrameBorder = light_gray;
-    ios_palette_off.A11yGlyph = a11y_glyph_off;
-
-    // setup config
-    ImGuiToggleConfig config;
-    config.Size = ImVec2(ios_width, ios_height);
-    config.Flags |= ImGuiToggleFlags_A11y
-        | ImGuiToggleFlags_Animated
-        | (light_mode ? ImGuiToggleFlags_Bordered : 0);
-    config.A11yStyle = ImGuiToggleA11yStyle_Glyph;
-
-    // setup 'on' config
-    config.On.FrameBorderThickness = 0;
-    config.On.KnobBorderThickness = ios_border_thickness;
-    config.On.KnobOffset = ImVec2(ios_offset, 0);
-    config.On.KnobInset = ios_inset;
-    config.On.Palette = &ios_palette_on;
-
-    // setup 'off' config
-    config.Off.FrameBorderThickness = ios_frame_border_thickness;
-    config.Off.KnobBorderThickness = ios_border_thickness;
-    config.Off.KnobOffset = ImVec2(ios_offset, 0);
-    config.Off.KnobInset = ios_inset;
-    config.Off.Palette = &ios_palette_off;
+    return ::GetScaledPreset(::ScaledPreset_iOS, size_scale, light_mode, ::BuildiOSStyle);
+}
 
-    return config;
+ImGuiToggleConfig ImGuiTogglePresets::MaterialStyle(float size_scale /*= 1.0f*/)
+{
+    return ::GetScaledPreset(::ScaledPreset_Material, size_scale, false, ::BuildMaterialStyle);
 }
 
-ImGuiToggleConfig ImGuiTogglePresets::MaterialStyle(float _size_scale /*= 1.0f*/)
+ImGuiToggleConfig ImGuiTogglePresets::MinecraftStyle(float size_scale /*= 1.0f*/)
 {
-    float size_scale = DpiFactor() * _size_scale;
+    return ::GetScaledPreset(::ScaledPreset_Minecraft, size_scale, false, ::BuildMinecraftStyle);
+}
 
-    const ImVec4 purple(0.4f, 0.08f, 0.97f, 1.0f);
-    const ImVec4 purple_dim(0.78f, 0.65f, 0.99f, 1.0f);
-    const ImVec4 purple_hover(0.53f, 0.08f, 1.0f, 1.0f);
+namespace
+{
+    // the palettes of the scaled presets don't depend on their scale, so each is built once and shared by every context and scale.
+    const ImVec4 iOSLightGray(0.89f, 0.89f, 0.89f, 1.0f);
 
-    const ImVec2 material_size(37 * size_scale, 16 * size_scale);
-    const float material_inset = -2.5f * size_scale;
+    ImGuiTogglePalette MakeiOSPaletteOn()
+    {
+        const ImVec4 frame_on(0.3f, 0.85f, 0.39f, 1.0f);
+        const ImVec4 frame_on_hover(0.0f, 1.0f, 0.57f, 1.0f);
+        const ImVec4 a11y_glyph_on(1.0f, 1.0f, 1.0f, 1.0f);
+
+        ImGuiTogglePalette ios_palette_on;
+        ios_palette_on.Knob = ::White;
+        ios_palette_on.Frame = frame_on;
+        ios_palette_on.FrameHover = frame_on_hover;
+        ios_palette_on.KnobBorder = ::iOSLightGray;
+        ios_palette_on.FrameBorder = ::iOSLightGray;
+        ios_palette_on.A11yGlyph = a11y_glyph_on;
+
+        return ios_palette_on;
+    }
 
-    static ImGuiTogglePalette material_palette_on;
-    material_palette_on.Frame = purple_dim;
-    material_palette_on.FrameHover = purple_dim;
-    material_palette_on.Knob = purple;
-    material_palette_on.KnobHover = purple_hover;
+    ImGuiTogglePalette MakeiOSPaletteOff(bool light_mode)
+    {
+        const ImVec4 dark_mode_frame_off(0.22f, 0.22f, 0.24f, 1.0f);
+        const ImVec4 light_mode_frame_off(0.91f, 0.91f, 0.92f, 1.0f);
+        const ImVec4 dark_mode_frame_off_hover(0.4f, 0.4f, 0.4f, 1.0f);
+        const ImVec4 light_mode_frame_off_hover(0.7f, 0.7f, 0.7f, 1.0f);
+        const ImVec4 a11y_glyph_off(0.4f, 0.4f, 0.4f, 1.0f);
+
+        ImGuiTogglePalette ios_palette_off;
+        ios_palette_off.Knob = ::White;
+        ios_palette_off.Frame = light_mode ? light_mode_frame_off : dark_mode_frame_off;
+        ios_palette_off.FrameHover = light_mode ? light_mode_frame_off_hover : light_mode_frame_off_hover;
+        ios_palette_off.KnobBorder = ::iOSLightGray;
+        ios_palette_off.FrameBorder = ::iOSLightGray;
+        ios_palette_off.A11yGlyph = a11y_glyph_off;
+
+        return ios_palette_off;
+    }
 
-    // setup config
-    ImGuiToggleConfig config;
-    config.Flags |= ImGuiToggleFlags_Animated;
-    config.Size = material_size;
-    config.On.KnobInset = config.Off.KnobInset = material_inset;
-    config.On.KnobOffset = config.Off.KnobOffset = ImVec2(-material_inset, 0);
-    config.On.Palette = &material_palette_on;
+    ImGuiTogglePalette MakeMaterialPaletteOn()
+    {
+        const ImVec4 purple(0.4f, 0.08f, 0.97f, 1.0f);
+        const ImVec4 purple_dim(0.78f, 0.65f, 0.99f, 1.0f);
+        const ImVec4 purple_hover(0.53f, 0.08f, 1.0f, 1.0f);
 
-    return config;
-}
+        ImGuiTogglePalette material_palette_on;
+        material_palette_on.Frame = purple_dim;
+        material_palette_on.FrameHover = purple_dim;
+        material_palette_on.Knob = purple;
+        material_palette_on.KnobHover = purple_hover;
 
-ImGuiToggleConfig ImGuiTogglePresets::MinecraftStyle(float _size_scale /*= 1.0f*/)
-{
-    float size_scale = DpiFactor() * _size_scale;
-
-    const ImVec4 gray(0.35f, 0.35f, 0.35f, 1.0f);
-    const ImVec4 dark_gray(0.12f, 0.12f, 0.12f, 1.0f);
-    const ImVec4 frame_border_off(0.6f, 0.6f, 0.61f, 1.0f);
-    const ImVec4 toggle_frame_off(0.55f, 0.55f, 0.56f, 1.0f);
-    const ImVec4 gray_knob(0.82f, 0.82f, 0.83f, 1.0f);
-
-    const ImVec2 minecraft_knob_size(56.0f * size_scale, 40.0f * size_scale);
-    const ImVec2 minecraft_size(104.0f * size_scale, 40.0f * size_scale); // 112x48
-    const float minecraft_borders = 4.0f * size_scale;
-    const ImVec2 minecraft_offset(0.0f * size_scale, -minecraft_borders * 2.0f);
-    const ImOffsetRect minecraft_inset(
-        0.0f * size_scale, // top
-        -16.0f * size_scale, // left
-        0.0f * size_scale, // bottom
-        0.0f * size_scale  // right
-    );
-    const float minecraft_rounding = 0.0f; // disable rounding
-    const float minecraft_shadows = 4.0f * size_scale;
-
-    // set up the "on" palette.
-    static ImGuiTogglePalette minecraft_palette_on;
-    minecraft_palette_on.Frame = ::Green;
-    minecraft_palette_on.FrameHover = ::Green;
-    minecraft_palette_on.FrameBorder = ::GreenBorder;
-    minecraft_palette_on.FrameShadow = ::Black;
-    minecraft_palette_on.Knob = gray_knob;
-    minecraft_palette_on.KnobHover = gray_knob;
-    minecraft_palette_on.A11yGlyph = ::White;
-    minecraft_palette_on.KnobBorder = ::White;
-    minecraft_palette_on.KnobShadow = ::Black;
-
-    // start the "off" palette as a copy of the on
-    static ImGuiTogglePalette minecraft_palette_off;
-    minecraft_palette_off = minecraft_palette_on;
-
-    // make changes to the off palette
-    minecraft_palette_off.Frame = toggle_frame_off;
-    minecraft_palette_off.FrameHover = toggle_frame_off;
-    minecraft_palette_off.FrameBorder = frame_border_off;
-
-    // setup config
-    ImGuiToggleConfig config;
-    config.Flags |= ImGuiToggleFlags_A11y | ImGuiToggleFlags_Bordered | ImGuiToggleFlags_Shadowed;
-    config.Size = minecraft_size;
-    config.FrameRounding = minecraft_rounding;
-    config.KnobRounding = minecraft_rounding;
-    config.A11yStyle = ImGuiToggleA11yStyle_Glyph;
-
-    // set up the "on" state configuration
-    config.On.KnobInset = minecraft_inset;
-    config.On.KnobOffset = minecraft_offset;
-    config.On.FrameBorderThickness = minecraft_borders;
-    config.On.FrameShadowThickness = minecraft_shadows;
-    config.On.KnobBorderThickness = minecraft_borders;
-    config.On.KnobShadowThickness = minecraft_shadows;
-    config.On.Palette = &minecraft_palette_on;
-
-    // duplicate the "on" config to the "off", then make changes.
-    config.Off = config.On;
-    config.Off.KnobInset = minecraft_inset.MirrorHorizontally();
-    config.Off.Palette = &minecraft_palette_off;
+        return material_palette_on;
+    }
 
-    return config;
-}
+    ImGuiTogglePalette MakeMinecraftPaletteOn()
+    {
+        const ImVec4 gray_knob(0.82f, 0.82f, 0.83f, 1.0f);
+
+        ImGuiTogglePalette minecraft_palette_on;
+        minecraft_palette_on.Frame = ::Green;
+        minecraft_palette_on.FrameHover = ::Green;
+        minecraft_palette_on.FrameBorder = ::GreenBorder;
+        minecraft_palette_on.FrameShadow = ::Black;
+        minecraft_palette_on.Knob = gray_knob;
+        minecraft_palette_on.KnobHover = gray_knob;
+        minecraft_palette_on.A11yGlyph = ::White;
+        minecraft_palette_on.KnobBorder = ::White;
+        minecraft_palette_on.KnobShadow = ::Black;
+
+        return minecraft_palette_on;
+    }
+
+    ImGuiTogglePalette MakeMinecraftPaletteOff()
+    {
+        const ImVec4 frame_border_off(0.6f, 0.6f, 0.61f, 1.0f);
+        const ImVec4 toggle_frame_off(0.55f, 0.55f, 0.56f, 1.0f);
+
+        // start the "off" palette as a copy of the on, then make changes.
+        ImGuiTogglePalette minecraft_palette_off = ::MakeMinecraftPaletteOn();
+        minecraft_palette_off.Frame = toggle_frame_off;
+        minecraft_palette_off.FrameHover = toggle_frame_off;
+        minecraft_palette_off.FrameBorder = frame_border_off;
+
+        return minecraft_palette_off;
+    }
+
+    void BuildiOSStyle(ImGuiToggleConfig* config, float size_scale, bool light_mode)
+    {
+        static const ImGuiTogglePalette ios_palette_on = ::MakeiOSPaletteOn();
+        static const ImGuiTogglePalette ios_palette_off_dark = ::MakeiOSPaletteOff(false);
+        static const ImGuiTogglePalette ios_palette_off_light = ::MakeiOSPaletteOff(true);
+
+        const float ios_width = 153 * size_scale;
+        const float ios_height = 93 * size_scale;
+        const float ios_frame_border_thickness = 0.0f * size_scale;
+        const float ios_border_thickness = 0.0f * size_scale;
+        const float ios_offset = 0.0f * size_scale;
+        const float ios_inset = 6.0f * size_scale;
+
+        // setup config
+        config->Size = ImVec2(ios_width, ios_height);
+        config->Flags |= ImGuiToggleFlags_A11y
+            | ImGuiToggleFlags_Animated
+            | (light_mode ? ImGuiToggleFlags_Bordered : 0);
+        config->A11yStyle = ImGuiToggleA11yStyle_Glyph;
+
+        // setup 'on' config
+        config->On.FrameBorderThickness = 0;
+        config->On.KnobBorderThickness = ios_border_thickness;
+        config->On.KnobOffset = ImVec2(ios_offset, 0);
+        config->On.KnobInset = ios_inset;
+        config->On.Palette = &ios_palette_on;
+
+        // setup 'off' config
+        config->Off.FrameBorderThickness = ios_frame_border_thickness;
+        config->Off.KnobBorderThickness = ios_border_thickness;
+        config->Off.KnobOffset = ImVec2(ios_offset, 0);
+        config->Off.KnobInset = ios_inset;
+        config->Off.Palette = light_mode ? &ios_palette_off_light : &ios_palette_off_dark;
+    }
+
+    void BuildMaterialStyle(ImGuiToggleConfig* config, float size_scale, bool light_mode)
+    {
+        IM_UNUSED(light_mode);
 
+        static const ImGuiTogglePalette material_palette_on = ::MakeMaterialPaletteOn();
 
+        const ImVec2 material_size(37 * size_scale, 16 * size_scale);
+        const float material_inset = -2.5f * size_scale;
+
+        // setup config
+        config->Flags |= ImGuiToggleFlags_Animated;
+        config->Size = material_size;
+        config->On.KnobInset = config->Off.KnobInset = material_inset;
+        config->On.KnobOffset = config->Off.KnobOffset = ImVec2(-material_inset, 0);
+        config->On.Palette = &material_palette_on;
+    }
+
+    void BuildMinecraftStyle(ImGuiToggleConfig* config, float size_scale, bool light_mode)
+    {
+        IM_UNUSED(light_mode);
+
+        static const ImGuiTogglePalette minecraft_palette_on = ::MakeMinecraftPaletteOn();
+        static const ImGuiTogglePalette minecraft_palette_off = ::MakeMinecraftPaletteOff();
+
+        const ImVec2 minecraft_size(104.0f * size_scale, 40.0f * size_scale); // 112x48
+        const float minecraft_borders = 4.0f * size_scale;
+        const ImVec2 minecraft_offset(0.0f * size_scale, -minecraft_borders * 2.0f);
+        const ImOffsetRect minecraft_inset(
+            0.0f * size_scale, // top
+            -16.0f * size_scale, // left
+            0.0f * size_scale, // bottom
+            0.0f * size_scale  // right
+        );
+        const float minecraft_rounding = 0.0f; // disable rounding
+        const float minecraft_shadows = 4.0f * size_scale;
+
+        // setup config
+        config->Flags |= ImGuiToggleFlags_A11y | ImGuiToggleFlags_Bordered | ImGuiToggleFlags_Shadowed;
+        config->Size = minecraft_size;
+        config->FrameRounding = minecraft_rounding;
+        config->KnobRounding = minecraft_rounding;
+        config->A11yStyle = ImGuiToggleA11yStyle_Glyph;
+
+        // set up the "on" state configuration
+        config->On.KnobInset = minecraft_inset;
+        config->On.KnobOffset = minecraft_offset;
+        config->On.FrameBorderThickness = minecraft_borders;
+        config->On.FrameShadowThickness = minecraft_shadows;
+        config->On.KnobBorderThickness = minecraft_borders;
+        config->On.KnobShadowThickness = minecraft_shadows;
+        config->On.Palette = &minecraft_palette_on;
+
+        // duplicate the "on" config to the "off", then make changes.
+        config->Off = config->On;
+        config->Off.KnobInset = minecraft_inset.MirrorHorizontally();
+        config->Off.Palette = &minecraft_palette_off;
+    }
+} // namespace
@@ -1,8 +1,11 @@
 #pragma once
 
 #include "imgui_toggle.h"
+#include "imgui_toggle_palette.h"
 
 // ImGuiTogglePresets: A few canned configurations for various presets OOTB.
+//   The presets are built once and returned as copies, so they are cheap to use every frame: the palettes they point to are never freed.
+//   Presets that scale with the font size are built per ImGui context for each scale and font size they're used with.
 namespace ImGuiTogglePresets
 {
     // The default, unmodified style.
@@ -23,3 +26,38 @@ namespace ImGuiTogglePresets
     // A style that emulates what a toggle close to one from Minecraft.
     ImGuiToggleConfig MinecraftStyle(float size_scale = 1.0f);
 }
+
+// ImGuiTogglePresetKey: What a scaled preset was built for.
+struct ImGuiTogglePresetKey
+{
+    int Preset;
+    float SizeScale;
+    bool LightMode;
+    float FontSize;
+};
+
+// ImGuiTogglePresetCacheEntry: A preset built for a key, and the last frame it was used.
+struct ImGuiTogglePresetCacheEntry
+{
+    ImGuiTogglePresetKey Key;
+    int LastFrameUsed;
+    ImGuiToggleConfig Config;
+};
+
+// ImGuiTogglePresetCache: The scaled presets built for a context.
+//   Entries are allocated individually so references to them stay valid as more presets are built. Presets that go unused for a while are evicted.
+struct ImGuiTogglePresetCache
+{
+    ImVector<ImGuiTogglePresetCacheEntry*> Entries;
+    ImGuiStorage EntryIndices;              // Key hash -> entry, or the next free key after it for presets sharing a hash.
+    int LastEvictionFrame = 0;
+
+    ~ImGuiTogglePresetCache() { Clear(); }
+
+    ImGuiTogglePresetCacheEntry* Find(const ImGuiTogglePresetKey& key) const;
+    ImGuiTogglePresetCacheEntry* Add(const ImGuiTogglePresetKey& key);
+
+    // Evicts presets that haven't been used for a while. Called once a frame, it only does work every so often.
+    void EvictUnused(int frame_count);
+    void Clear();
+};
@@ -0,0 +1,111 @@
+#include "imgui_toggle.h"
+#include "imgui_toggle_profile.h"
+#include "imgui_internal.h"
+
+#ifdef IMGUI_TOGGLE_ENABLE_CHROME_TRACE
+
+#include <chrono>
+
+namespace
+{
+    // the most zones a thread records before writing, so a trace that is never written can't grow without bound.
+    const int TraceEventCapacity = 1 << 20;
+
+    // ToggleTraceEvent: A single complete zone, in microseconds as chrome traces expect.
+    struct ToggleTraceEvent
+    {
+        const char* Name;
+        double StartMicroseconds;
+        double DurationMicroseconds;
+    };
+
+    // each thread records into its own buffer, so zones can be recorded without locking.
+    thread_local ImVector<ToggleTraceEvent> ThreadTraceEvents;
+
+    inline double GetTraceMicroseconds()
+    {
+        using clock = std::chrono::steady_clock;
+        return std::chrono::duration<double, std::micro>(clock::now().time_since_epoch()).count();
+    }
+
+    // a stable id for the calling thread, as chrome traces group zones by thread.
+    inline unsigned int GetTraceThreadId()
+    {
+        const ImVector<ToggleTraceEvent>* events = &ThreadTraceEvents;
+        return ImHashData(&events, sizeof(events)) & 0x7FFFFFFF;
+    }
+} // namespace
+
+ImGuiToggleTraceScope::ImGuiToggleTraceScope(const char* name) : Name(name), StartMicroseconds(::GetTraceMicroseconds())
+{
+}
+
+ImGuiToggleTraceScope::~ImGuiToggleTraceScope()
+{
+    ImVector<ToggleTraceEvent>& events = ::ThreadTraceEvents;
+    if (events.Size >= ::TraceEventCapacity)
+    {
+        return;
+    }
+
+    ToggleTraceEvent event;
+    event.Name = Name;
+    event.StartMicroseconds = StartMicroseconds;
+    event.DurationMicroseconds = ::GetTraceMicroseconds() - StartMicroseconds;
+    events.push_back(event);
+}
+
+bool ImGui::WriteToggleChromeTrace(const char* filename)
+{
+    // open the file first, so the zones are kept for another try if it can't be.
+    ImFileHandle file = ImFileOpen(filename, "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    ImVector<ToggleTraceEvent>& events = ::ThreadTraceEvents;
+    const unsigned int thread_id = ::GetTraceThreadId();
+
+    // zone names are string literals, so they need no escaping.
+    ImGuiTextBuffer json;
+    json.reserve(events.Size * 96 + 64);
+    json.appendf("{\"traceEvents\":[\n");
+    for (int i = 0; i < events.Size; ++i)
+    {
+        const ToggleTraceEvent& event = events[i];
+        json.appendf("{\"name\":\"%s\",\"cat\":\"imgui_toggle\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}%s\n",
+            event.Name, event.StartMicroseconds, event.DurationMicroseconds, thread_id, i + 1 < events.Size ? "," : "");
+    }
+    json.appendf("],\"displayTimeUnit\":\"ns\"}\n");
+
+    const bool written = ImFileWrite(json.c_str(), sizeof(char), (ImU64)json.size(), file) == (ImU64)json.size();
+    ImFileClose(file);
+
+    // only forget the zones once they're safely written.
+    if (written)
+    {
+        events.clear();
+    }
+
+    return written;
+}
+
+void ImGui::ClearToggleChromeTrace()
+{
+    ::ThreadTraceEvents.clear();
+}
+
+#else
+
+bool ImGui::WriteToggleChromeTrace(const char* filename)
+{
+    IM_UNUSED(filename);
+    return false;
+}
+
+void ImGui::ClearToggleChromeTrace()
+{
+}
+
+#endif // IMGUI_TOGGLE_ENABLE_CHROME_TRACE
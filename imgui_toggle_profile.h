@@ -0,0 +1,29 @@
+#pragma once
+
+#include "imgui.h"
+
+// IMGUI_TOGGLE_PROFILE_SCOPE(name): Marks the rest of the enclosing scope as a zone named `name`, a string literal, for a frame profiler.
+//   Expands to nothing by default. Define it in your imconfig.h to map zones to your own profiler, e.g. for Tracy:
+//       #define IMGUI_TOGGLE_PROFILE_SCOPE(name) ZoneScopedN(name)
+//   Or define IMGUI_TOGGLE_ENABLE_CHROME_TRACE to record zones with the built-in reference backend, see ImGui::WriteToggleChromeTrace().
+#ifndef IMGUI_TOGGLE_PROFILE_SCOPE
+#ifdef IMGUI_TOGGLE_ENABLE_CHROME_TRACE
+#define IMGUI_TOGGLE_PROFILE_SCOPE(name) ImGuiToggleTraceScope toggle_profile_scope(name)
+#else
+#define IMGUI_TOGGLE_PROFILE_SCOPE(name)
+#endif
+#endif // IMGUI_TOGGLE_PROFILE_SCOPE
+
+#ifdef IMGUI_TOGGLE_ENABLE_CHROME_TRACE
+
+// ImGuiToggleTraceScope: Records the time between its construction and destruction as a zone, for the calling thread's chrome trace.
+struct ImGuiToggleTraceScope
+{
+    const char* Name;
+    double StartMicroseconds;
+
+    explicit ImGuiToggleTraceScope(const char* name);
+    ~ImGuiToggleTraceScope();
+};
+
+#endif // IMGUI_TOGGLE_ENABLE_CHROME_TRACE
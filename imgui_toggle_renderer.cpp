@@ -1,12 +1,24 @@
 #include "imgui_toggle_renderer.h"
+#include "imgui_toggle_context.h"
 #include "imgui_toggle_palette.h"
 #include "imgui_toggle_math.h"
+#include "imgui_toggle_profile.h"
+#include "imgui_toggle_stats.h"
 
 using namespace ImGuiToggleConstants;
 using namespace ImGuiToggleMath;
 
 namespace
 {
+    // the fewest segments a round knob is drawn with at coarse detail, so it still reads as round.
+    const int LodCircleSegmentsMinimum = 6;
+
+    // the ID used to animate a single toggle in a grid.
+    inline ImGuiID GetGridToggleId(ImGuiID grid_id, int index)
+    {
+        return ImHashData(&index, sizeof(index), grid_id);
+    }
+
     // a small helper to quickly check the mixed value flag.
     inline bool IsItemMixedValue()
     {
@@ -18,60 +30,134 @@ namespace
     }
 } // namespace
 
-ImGuiToggleRenderer::ImGuiToggleRenderer()
+ImGuiToggleRenderer::ImGuiToggleRenderer(ImGuiToggleContext* context) : _userConfig(nullptr), _fixedFlags(ImGuiToggleFlags_None), _hasFixedFlags(false), _context(context), _label(nullptr), _value(false)
 {
-    SetConfig(nullptr, nullptr, ImGuiToggleConfig());
+    _internedLabel = nullptr;
+    _internedId = 0;
+    CompileConfig(&_compiledStorage, _compiledStorage.Config, _compiledStorage.Config.Flags);
+    _compiled = &_compiledStorage;
+    _config = &_compiledStorage.Config;
+    _lod = ImGuiToggleLod_Full;
 }
 
-ImGuiToggleRenderer::ImGuiToggleRenderer(const char* label, bool* value, const ImGuiToggleConfig& user_config) : _style(nullptr), _label(label), _value(value)
+ImGuiToggleRenderer::ImGuiToggleRenderer(ImGuiToggleContext* context, const char* label, bool* value, const ImGuiToggleConfig& user_config) : ImGuiToggleRenderer(context)
 {
-    SetConfig(label, value, user_config);
+    // the config may be a temporary, so it's copied now rather than referenced until the toggle is drawn.
+    CompileConfig(&_compiledStorage, user_config, user_config.Flags);
+    SetCompiledConfig(label, ImGuiToggleBinding::FromBool(value), _compiledStorage);
 }
 
-void ImGuiToggleRenderer::SetConfig(const char* label, bool* value, const ImGuiToggleConfig& user_config)
+void ImGuiToggleRenderer::SetConfig(const char* label, const ImGuiToggleBinding& binding, const ImGuiToggleConfig& user_config)
 {
     // store mandatory settings
     _label = label;
-    _value = value;
+    _binding = binding;
+    _internedLabel = nullptr;
+
+    // the config is copied and validated once the toggle is known to be visible.
+    _userConfig = &user_config;
+    _hasFixedFlags = false;
+
+    // the level of detail is picked as each toggle is drawn.
+    _lod = ImGuiToggleLod_Full;
+}
+
+void ImGuiToggleRenderer::SetCompiledConfig(const char* label, const ImGuiToggleBinding& binding, const ImGuiToggleCompiledConfig& compiled_config)
+{
+    // store mandatory settings
+    _label = label;
+    _binding = binding;
+    _internedLabel = nullptr;
+
+    // the compiled config was validated when it was compiled, so it's drawn from where it is.
+    _userConfig = nullptr;
+    _hasFixedFlags = false;
+    _compiled = &compiled_config;
+
+    // the level of detail is picked as each toggle is drawn.
+    _lod = ImGuiToggleLod_Full;
+}
+
+void ImGuiToggleRenderer::CompileConfig(ImGuiToggleCompiledConfig* compiled, const ImGuiToggleConfig& config, ImGuiToggleFlags flags)
+{
+    IM_ASSERT(compiled != nullptr);
+
+    // copy the config and ensure it's valid.
+    compiled->Config = config;
+    ValidateConfig(compiled->Config);
+
+    // fixed flags replace the config's own, even if it had none.
+    if (flags != config.Flags)
+    {
+        compiled->Config.Flags = flags;
+    }
+
+    // derive what the renderer would otherwise check each time it draws.
+    const ImGuiToggleConfig& compiled_config = compiled->Config;
+    compiled->IsAnimated = (compiled_config.Flags & ImGuiToggleFlags_Animated) != 0 && compiled_config.AnimationDuration > 0.0f;
+    compiled->HasCircleKnob = compiled_config.KnobRounding >= 1.0f;
+    compiled->LabelOffsetX = CalculateLabelOffsetX(compiled_config);
+}
+
+void ImGuiToggleRenderer::ApplyConfig()
+{
+    // compile our user's config, unless we were given one already compiled.
+    if (_userConfig != nullptr)
+    {
+        CompileConfig(&_compiledStorage, *_userConfig, _hasFixedFlags ? _fixedFlags : _userConfig->Flags);
+        _compiled = &_compiledStorage;
+    }
 
-    // copy our user's config and ensure it's valid.
-    _config = user_config;
-    ValidateConfig();
+    _config = &_compiled->Config;
 }
 
+template<ImGuiToggleFlags Features>
 bool ImGuiToggleRenderer::Render()
 {
+    IMGUI_TOGGLE_PROFILE_SCOPE("ImGuiToggleRenderer::Render");
     ImGuiWindow* window = ImGui::GetCurrentWindow();
 
     IM_ASSERT(window);
     IM_ASSERT(_label != nullptr);
-    IM_ASSERT(_value != nullptr);
+    IM_ASSERT(_binding.IsBound());
+    IM_ASSERT(_userConfig != nullptr || _compiled != nullptr);
+
+    IMGUI_TOGGLE_STATS_ADD(_context->Stats.Current, ToggleCount, 1);
 
     if (window->SkipItems)
     {
+        IMGUI_TOGGLE_STATS_ADD(_context->Stats.Current, ClippedCount, 1);
         return false;
     }
 
     // update igui context
     ImGuiContext& g = *GImGui;
-    _id = window->GetID(_label);
+    _id = _internedLabel != nullptr ? _internedId : window->GetID(_label);
     _drawList = ImGui::GetWindowDrawList();
+    IM_ASSERT(_context == ImGui::FindToggleContext());
     _style = &ImGui::GetStyle();
 
+    // lay the toggle out straight from the user's config and the label cache,
+    // so a clipped toggle is rejected before its config is copied and validated.
+    // a compiled config is already validated, so it's laid out from as is.
+    const ImGuiToggleConfig& layout_config = _userConfig != nullptr ? *_userConfig : _compiled->Config;
+
     // calculate the size of the toggle portion
-    const float height = _config.Size.y > 0
-        ? _config.Size.y
-        : ImGui::GetFrameHeight();
-    const float width = _config.Size.x > 0
-        ? _config.Size.x
-        : height * _config.WidthRatio;
+    const ImVec2 toggle_size = CalculateToggleSize(layout_config);
+    const float width = toggle_size.x;
+    const float height = toggle_size.y;
 
     // get the position of the widget and how large the label should be
     ImVec2 widget_position = window->DC.CursorPos;
-    ImVec2 label_size = ImGui::CalcTextSize(_label, nullptr, true);
+    const ImGuiToggleLabelMetrics label_metrics = _internedLabel != nullptr
+        ? _context->LabelCache.Measure(*_internedLabel)
+        : _context->LabelCache.Measure(_label, true);
+    const ImVec2 label_size = label_metrics.Size;
+    _labelSize = label_size;
+    _labelEnd = _label + label_metrics.RenderedLength;
 
     // if the knob is offset horizontally outside of the frame in the on state, we want to bump our label over.
-    const float label_x_offset = ImMax(0.0f, -_config.On.KnobOffset.x / 2.0f);
+    const float label_x_offset = _userConfig != nullptr ? CalculateLabelOffsetX(layout_config) : _compiled->LabelOffsetX;
 
     // calculate bounding boxes for the toggle, and the whole widget including the label for interaction
     _boundingBox = ImRect(widget_position, widget_position + ImVec2(width, height));
@@ -82,59 +168,286 @@ bool ImGuiToggleRenderer::Render()
             ImMax(height, label_size.y) + _style->FramePadding.y * 2.0f
         ));
 
+    ImGui::ItemSize(total_bounding_box, _style->FramePadding.y);
+    if (!ImGui::ItemAdd(total_bounding_box, _id))
+    {
+        IMGUI_TOGGLE_STATS_ADD(_context->Stats.Current, ClippedCount, 1);
+
+        // a clipped toggle isn't drawn, so it settles on its value now, rather than animating to it once it's next visible.
+        const ImGuiToggleFlags flags = _hasFixedFlags ? _fixedFlags : layout_config.Flags;
+        const bool is_animated = _userConfig != nullptr
+            ? (flags & ImGuiToggleFlags_Animated) != 0 && layout_config.AnimationDuration > 0.0f
+            : _compiled->IsAnimated;
+        if ((Features & ImGuiToggleFlags_Animated) != 0 && is_animated)
+        {
+            window->StateStorage.SetFloat(_id, ::IsItemMixedValue() ? 0.5f : (_binding.Read() ? 1.0f : 0.0f));
+        }
+
+        IMGUI_TEST_ENGINE_ITEM_INFO(_id, _label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (_binding.Read() ? ImGuiItemStatusFlags_Checked : 0));
+        return false;
+    }
+
+    // the toggle is visible, so now it's worth preparing its config and reading its value.
+    ApplyConfig();
+    _value = _binding.Read();
+
     // handle the toggle input behavior
     bool pressed = ToggleBehavior(total_bounding_box);
     _isMixedValue = ::IsItemMixedValue();
 
     // draw the toggle itself and the label
-    DrawToggle();
+    DrawToggle<Features>();
     DrawLabel(label_x_offset);
 
-    IMGUI_TEST_ENGINE_ITEM_INFO(_id, _label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (*_value ? ImGuiItemStatusFlags_Checked : 0));
+    IMGUI_TEST_ENGINE_ITEM_INFO(_id, _label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (_value ? ImGuiItemStatusFlags_Checked : 0));
     return pressed;
 }
 
+bool ImGuiToggleRenderer::RenderGrid(ImU64* bits, int count, int columns)
+{
+    IMGUI_TOGGLE_PROFILE_SCOPE("ImGuiToggleRenderer::RenderGrid");
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
 
-void ImGuiToggleRenderer::ValidateConfig()
+    IM_ASSERT(window);
+    IM_ASSERT(_label != nullptr);
+    IM_ASSERT(bits != nullptr);
+    IM_ASSERT(_userConfig != nullptr || _compiled != nullptr);
+    IM_ASSERT_USER_ERROR(count >= 0, "Grid count specified was negative.");
+    IM_ASSERT_USER_ERROR(columns > 0, "Grid needs at least one column.");
+
+    if (count <= 0 || columns <= 0)
+    {
+        return false;
+    }
+
+    IMGUI_TOGGLE_STATS_ADD(_context->Stats.Current, ToggleCount, count);
+
+    if (window->SkipItems)
+    {
+        IMGUI_TOGGLE_STATS_ADD(_context->Stats.Current, ClippedCount, count);
+        return false;
+    }
+
+    // update imgui context
+    ImGuiContext& g = *GImGui;
+    _id = window->GetID(_label);
+    _drawList = ImGui::GetWindowDrawList();
+    IM_ASSERT(_context == ImGui::FindToggleContext());
+    _style = &ImGui::GetStyle();
+
+    // a grid is resolved once for all of its toggles, so its config is always worth preparing.
+    ApplyConfig();
+
+    // every toggle in the grid shares the same size, and is spaced by the inner item spacing.
+    const ImVec2 toggle_size = CalculateToggleSize(*_config);
+    const ImVec2 cell_stride = toggle_size + _style->ItemInnerSpacing;
+    const int rows = (count + columns - 1) / columns;
+    const int used_columns = ImMin(columns, count);
+
+    // the whole grid is registered as a single item.
+    const ImVec2 grid_position = window->DC.CursorPos;
+    const ImVec2 grid_size = ImVec2(
+        used_columns * cell_stride.x - _style->ItemInnerSpacing.x,
+        rows * cell_stride.y - _style->ItemInnerSpacing.y);
+    const ImRect grid_bounding_box(grid_position, grid_position + grid_size);
+
+    ImGui::ItemSize(grid_bounding_box);
+    if (!ImGui::ItemAdd(grid_bounding_box, _id))
+    {
+        IMGUI_TOGGLE_STATS_ADD(_context->Stats.Current, ClippedCount, count);
+        IMGUI_TEST_ENGINE_ITEM_INFO(_id, _label, g.LastItemData.StatusFlags);
+        return false;
+    }
+
+    const ImGuiButtonFlags button_flags = ImGuiButtonFlags_PressedOnClick;
+    bool hovered, held;
+    bool pressed = ImGui::ButtonBehavior(grid_bounding_box, _id, &hovered, &held, button_flags);
+
+    // find the toggle under the mouse by dividing the grid-local mouse position by the cell stride,
+    // ignoring the spacing between toggles.
+    int hovered_index = -1;
+    if (hovered)
+    {
+        const ImVec2 local_mouse = g.IO.MousePos - grid_position;
+        const int column = (int)(local_mouse.x / cell_stride.x);
+        const int row = (int)(local_mouse.y / cell_stride.y);
+        const int index = row * columns + column;
+        const ImVec2 cell_mouse = local_mouse - ImVec2(column * cell_stride.x, row * cell_stride.y);
+
+        if (column >= 0 && column < columns && row >= 0 && index < count
+            && cell_mouse.x < toggle_size.x && cell_mouse.y < toggle_size.y)
+        {
+            hovered_index = index;
+        }
+    }
+
+    if (pressed)
+    {
+        if (hovered_index >= 0)
+        {
+            ImU64& word = bits[hovered_index / 64];
+            const ImU64 mask = (ImU64)1 << (hovered_index % 64);
+            word ^= mask;
+            ImGui::MarkItemEdited(_id);
+            RecordEvent(::GetGridToggleId(_id, hovered_index), (word & mask) != 0);
+
+            // grid toggles don't remember their last value, so only presses animate, starting from wherever the toggle was.
+            if (IsAnimated())
+            {
+                const ImGuiID toggle_id = ::GetGridToggleId(_id, hovered_index);
+                const float to = (word & mask) != 0 ? 1.0f : 0.0f;
+                float from = 1.0f - to;
+                _context->Animations.Sample(toggle_id, g.Time, &from);
+                _context->Animations.Start(toggle_id, from, to, g.Time, _config->AnimationDuration * ImAbs(to - from));
+            }
+        }
+        else
+        {
+            pressed = false;
+        }
+    }
+
+    // only draw the rows and columns inside the clip rect, with one extra on each side for any knob, border, or shadow overhang.
+    const ImRect& clip_rect = window->ClipRect;
+    const int row_first = ImMax(0, (int)ImFloor((clip_rect.Min.y - grid_position.y) / cell_stride.y) - 1);
+    const int row_last = ImMin(rows, (int)ImFloor((clip_rect.Max.y - grid_position.y) / cell_stride.y) + 2);
+    const int column_first = ImMax(0, (int)ImFloor((clip_rect.Min.x - grid_position.x) / cell_stride.x) - 1);
+    const int column_last = ImMin(used_columns, (int)ImFloor((clip_rect.Max.x - grid_position.x) / cell_stride.x) + 2);
+
+    // resolve the on and off palettes once for every toggle in the grid.
+    const ImGuiTogglePaletteCacheEntry& palettes = _context->PaletteCache.Resolve(_config->On.Palette, _config->Off.Palette, *_style);
+    const ImGuiToggleResolvedPalette palette_on = palettes.On;
+    const ImGuiToggleResolvedPalette palette_off = palettes.Off;
+
+    // only look toggles up in the animation pool if anything is animating.
+    ImGuiToggleAnimationPool& animations = _context->Animations;
+    const bool is_any_animating = IsAnimated() && !animations.IsEmpty();
+
+    // find the visible toggles that are animating, and blend all of their palettes at once.
+    _gridAnimatingIndices.resize(0);
+    _gridAnimatingPercents.resize(0);
+
+    if (is_any_animating)
+    {
+        for (int row = row_first; row < row_last; ++row)
+        {
+            for (int column = column_first; column < column_last; ++column)
+            {
+                const int index = row * columns + column;
+                if (index >= count)
+                {
+                    break;
+                }
+
+                float animation_percent = 0.0f;
+                if (animations.Sample(::GetGridToggleId(_id, index), g.Time, &animation_percent))
+                {
+                    _gridAnimatingIndices.push_back(index);
+                    _gridAnimatingPercents.push_back(animation_percent);
+                }
+            }
+        }
+    }
+
+    _gridAnimatingPalettes.resize(_gridAnimatingPercents.Size);
+    ImGui::BlendResolvedPalettesN(_gridAnimatingPalettes.Data, palette_off, palette_on, _gridAnimatingPercents.Data, _gridAnimatingPercents.Size);
+    int animating_cursor = 0;
+
+    IMGUI_TOGGLE_STATS_ADD(_context->Stats.Current, AnimatingCount, _gridAnimatingIndices.Size);
+    IMGUI_TOGGLE_STATS_ADD(_context->Stats.Current, PaletteBlendCount, _gridAnimatingPalettes.Size);
+    IMGUI_TOGGLE_STATS_DRAW_SCOPE(_context->Stats.Current, _drawList);
+    int drawn_count = 0;
+
+    // the draw functions read the value from `_value`, so it's set to each toggle's bit in turn.
+    _isMixedValue = false;
+
+    // only copy palettes and states when they change from the previous toggle drawn.
+    enum { CellStateNone, CellStateOff, CellStateOn, CellStateAnimating } last_cell_state = CellStateNone;
+
+    for (int row = row_first; row < row_last; ++row)
+    {
+        for (int column = column_first; column < column_last; ++column)
+        {
+            const int index = row * columns + column;
+            if (index >= count)
+            {
+                break;
+            }
+
+            const bool value = (bits[index / 64] & ((ImU64)1 << (index % 64))) != 0;
+            _value = value;
+            _isHovered = index == hovered_index;
+
+            const ImVec2 cell_position = grid_position + ImVec2(column * cell_stride.x, row * cell_stride.y);
+            _boundingBox = ImRect(cell_position, cell_position + toggle_size);
+
+            // the toggles are visited in the same order as when they were sampled.
+            if (animating_cursor < _gridAnimatingIndices.Size && _gridAnimatingIndices[animating_cursor] == index)
+            {
+                _animationPercent = _gridAnimatingPercents[animating_cursor];
+                UpdateStateConfig();
+                _palette = _gridAnimatingPalettes[animating_cursor];
+                _colorA11yGlyphOff = palette_off.A11yGlyph;
+                _colorA11yGlyphOn = palette_on.A11yGlyph;
+                last_cell_state = CellStateAnimating;
+                ++animating_cursor;
+            }
+            else if (last_cell_state != (value ? CellStateOn : CellStateOff))
+            {
+                _animationPercent = value ? 1.0f : 0.0f;
+                _state = value ? _config->On : _config->Off;
+                _palette = value ? palette_on : palette_off;
+                _colorA11yGlyphOff = _palette.A11yGlyph;
+                _colorA11yGlyphOn = _palette.A11yGlyph;
+                last_cell_state = value ? CellStateOn : CellStateOff;
+            }
+
+            DrawToggleBody();
+            ++drawn_count;
+        }
+    }
+
+    IMGUI_TOGGLE_STATS_ADD(_context->Stats.Current, ClippedCount, count - drawn_count);
+
+    IMGUI_TEST_ENGINE_ITEM_INFO(_id, _label, g.LastItemData.StatusFlags);
+    return pressed;
+}
+
+
+void ImGuiToggleRenderer::ValidateConfig(ImGuiToggleConfig& config)
 {
-    IM_ASSERT_USER_ERROR(_config.Size.x >= 0, "Size.x specified was negative.");
-    IM_ASSERT_USER_ERROR(_config.Size.y >= 0, "Size.y specified was negative.");
+    IM_ASSERT_USER_ERROR(config.Size.x >= 0, "Size.x specified was negative.");
+    IM_ASSERT_USER_ERROR(config.Size.y >= 0, "Size.y specified was negative.");
 
     // if no flags were specified, use defaults.
-    if (_config.Flags == ImGuiToggleFlags_None)
+    if (config.Flags == ImGuiToggleFlags_None)
     {
-        _config.Flags = ImGuiToggleFlags_Default;
+        config.Flags = ImGuiToggleFlags_Default;
     }
 
     // a zero or negative duration would prevent animation.
-    _config.AnimationDuration = ImMax(_config.AnimationDuration, AnimationDurationMinimum);
+    config.AnimationDuration = ImMax(config.AnimationDuration, AnimationDurationMinimum);
 
     // keep our size/scale and rounding numbers sane.
-    _config.FrameRounding = ImClamp(_config.FrameRounding, FrameRoundingMinimum, FrameRoundingMaximum);
-    _config.KnobRounding = ImClamp(_config.KnobRounding, KnobRoundingMinimum, KnobRoundingMaximum);
-    _config.WidthRatio = ImClamp(_config.WidthRatio, WidthRatioMinimum, WidthRatioMaximum);
+    config.FrameRounding = ImClamp(config.FrameRounding, FrameRoundingMinimum, FrameRoundingMaximum);
+    config.KnobRounding = ImClamp(config.KnobRounding, KnobRoundingMinimum, KnobRoundingMaximum);
+    config.WidthRatio = ImClamp(config.WidthRatio, WidthRatioMinimum, WidthRatioMaximum);
 
     // Make sure our a11y labels have values.
-    if (_config.On.Label == nullptr)
+    if (config.On.Label == nullptr)
     {
-        _config.On.Label = LabelA11yOnDefault;
+        config.On.Label = LabelA11yOnDefault;
     }
 
-    if (_config.Off.Label == nullptr)
+    if (config.Off.Label == nullptr)
     {
-        _config.Off.Label = LabelA11yOffDefault;
+        config.Off.Label = LabelA11yOffDefault;
     }
 }
 
 bool ImGuiToggleRenderer::ToggleBehavior(const ImRect& interaction_bounding_box)
 {
-    ImGui::ItemSize(interaction_bounding_box, _style->FramePadding.y);
-    if (!ImGui::ItemAdd(interaction_bounding_box, _id))
-    {
-        ImGuiContext& g = *GImGui;
-        IMGUI_TEST_ENGINE_ITEM_INFO(_id, _label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (*_value ? ImGuiItemStatusFlags_Checked : 0));
-        return false;
-    }
+    IMGUI_TOGGLE_PROFILE_SCOPE("ImGuiToggleRenderer::ToggleBehavior");
 
     // the meat and potatoes: the actual toggle button
     const ImGuiButtonFlags button_flags = ImGuiButtonFlags_PressedOnClick;
@@ -142,41 +455,143 @@ bool ImGuiToggleRenderer::ToggleBehavior(const ImRect& interaction_bounding_box)
     bool pressed = ImGui::ButtonBehavior(interaction_bounding_box, _id, &hovered, &held, button_flags);
     if (pressed)
     {
-        *_value = !(*_value);
+        _value = !_value;
+        _binding.Write(_value);
         ImGui::MarkItemEdited(_id);
+        RecordEvent(_id, _value);
     }
 
     return pressed;
 }
 
-void ImGuiToggleRenderer::DrawToggle()
+void ImGuiToggleRenderer::RecordEvent(ImGuiID id, bool value)
 {
-    const float height = GetHeight();
-    const float width = GetWidth();
+    ImGuiToggleEventRing& events = _context->Events;
+    if (!events.IsEnabled())
+    {
+        return;
+    }
+
+    ImGuiToggleEvent event;
+    event.Id = id;
+    event.Value = value;
+    event.Time = GImGui->Time;
+    events.Push(event);
+}
 
+template<ImGuiToggleFlags Features>
+void ImGuiToggleRenderer::DrawToggle()
+{
+    IMGUI_TOGGLE_PROFILE_SCOPE("ImGuiToggleRenderer::DrawToggle");
     ImGuiContext& g = *GImGui;
     // update imgui state
     _isHovered = g.HoveredId == _id;
-    _isLastActive = g.LastActiveId == _id;
-    _lastActiveTimer = g.LastActiveIdTimer;
-
-    // radius is by default half the diameter
-    const float knob_radius = height * DiameterToRadiusRatio;
+    IMGUI_TOGGLE_STATS_DRAW_SCOPE(_context->Stats.Current, _drawList);
 
     // update the toggle's animation timer, state, and palette.
-    UpdateAnimationPercent();
-    UpdateStateConfig();
-    UpdatePalette();
+    UpdateAnimationPercent<Features>();
+    UpdateStateConfig<Features>();
+    UpdatePalette<Features>();
+
+    // toggles that draw just as they did last time copy what they drew, rather than drawing it again.
+    ImGuiToggleRetainedKey retained_key;
+    const bool is_retained = CanRetain<Features>();
+    if (is_retained)
+    {
+        InitRetainedKey<Features>(&retained_key);
+        if (_context->Retained.Draw(_drawList, _id, retained_key, GetPosition(), GImGui->FrameCount))
+        {
+            IMGUI_TOGGLE_STATS_ADD(_context->Stats.Current, RetainedCount, 1);
+            return;
+        }
+    }
+
+    const ImGuiToggleRetainedMark retained_mark = _context->Retained.Mark(_drawList);
+    DrawToggleBody<Features>();
+
+    if (is_retained)
+    {
+        _context->Retained.Capture(_drawList, retained_mark, _id, retained_key, GetPosition(), GImGui->FrameCount);
+    }
+}
+
+template<ImGuiToggleFlags Features>
+bool ImGuiToggleRenderer::CanRetain() const
+{
+#ifdef IMGUI_TOGGLE_DISABLE_RETAINED
+    return false;
+#else
+    // batched toggles draw later, and text labels depend on the font and the contents of the label strings, so neither is retained.
+    if (_context->Batch.DrawList == _drawList)
+    {
+        return false;
+    }
+
+    return !HasFeature<Features>(ImGuiToggleFlags_A11y) || _config->A11yStyle != ImGuiToggleA11yStyle_Label;
+#endif
+}
+
+template<ImGuiToggleFlags Features>
+void ImGuiToggleRenderer::InitRetainedKey(ImGuiToggleRetainedKey* key) const
+{
+    // clear everything first, so the key can be compared as raw memory.
+    memset((void*)key, 0, sizeof(*key));
+
+    key->Size = GetToggleSize();
+    key->AnimationPercent = _animationPercent;
+    key->IsHovered = _isHovered;
+    key->Flags = _config->Flags & Features;
+    key->A11yStyle = _config->A11yStyle;
+    key->Lod = CalculateLod();
+    key->FrameRounding = _config->FrameRounding;
+    key->KnobRounding = _config->KnobRounding;
+
+    key->FrameBorderThickness = _state.FrameBorderThickness;
+    key->FrameShadowThickness = _state.FrameShadowThickness;
+    key->KnobBorderThickness = _state.KnobBorderThickness;
+    key->KnobShadowThickness = _state.KnobShadowThickness;
+    key->KnobInset = _state.KnobInset;
+    key->KnobOffset = _state.KnobOffset;
+
+    key->Palette = _palette;
+    key->A11yGlyphOff = _colorA11yGlyphOff;
+    key->A11yGlyphOn = _colorA11yGlyphOn;
+
+    key->DrawListFlags = _drawList->Flags;
+    key->FringeScale = _drawList->_FringeScale;
+    key->CircleSegmentMaxError = _drawList->_Data->CircleSegmentMaxError;
+    key->FontSize = _drawList->_Data->FontSize;
+    key->TexUvWhitePixel = _drawList->_Data->TexUvWhitePixel;
+#if IMGUI_VERSION_NUM < 19200
+    key->TextureId = _drawList->_CmdHeader.TextureId;
+#endif
+}
+
+template<ImGuiToggleFlags Features>
+void ImGuiToggleRenderer::DrawToggleBody()
+{
+    // small toggles are drawn with less detail, if the config asks for it.
+    _lod = CalculateLod();
+
+    // radius is by default half the diameter
+    const float knob_radius = GetHeight() * DiameterToRadiusRatio;
 
     // get colors modified by hover.
-    const ImU32 color_frame = ImGui::GetColorU32(_isHovered ? _palette.FrameHover : _palette.Frame);
-    const ImU32 color_knob = ImGui::GetColorU32(_isHovered ? _palette.KnobHover : _palette.Knob);
+    const ImU32 color_frame = _isHovered ? _palette.FrameHover : _palette.Frame;
+    const ImU32 color_knob = _isHovered ? _palette.KnobHover : _palette.Knob;
+
+    // the smallest toggles are just a frame and a knob.
+    if (_lod == ImGuiToggleLod_Led)
+    {
+        DrawLed(color_frame, color_knob, knob_radius);
+        return;
+    }
 
     // draw the background frame
-    DrawFrame(color_frame);
+    DrawFrame<Features>(color_frame);
 
     // draw accessibility labels, if enabled.
-    if (HasA11yGlyphs())
+    if (HasA11yGlyphs<Features>())
     {
         DrawA11yFrameOverlays(knob_radius);
     }
@@ -184,11 +599,11 @@ void ImGuiToggleRenderer::DrawToggle()
     // draw the knob
     if (HasCircleKnob())
     {
-        DrawCircleKnob(knob_radius, color_knob);
+        DrawCircleKnob<Features>(knob_radius, color_knob);
     }
     else if (HasRectangleKnob())
     {
-        DrawRectangleKnob(knob_radius, color_knob);
+        DrawRectangleKnob<Features>(knob_radius, color_knob);
     }
     else
     {
@@ -197,29 +612,35 @@ void ImGuiToggleRenderer::DrawToggle()
     }
 }
 
+template<ImGuiToggleFlags Features>
 void ImGuiToggleRenderer::DrawFrame(ImU32 color_frame)
 {
     const float height = GetHeight();
-    const float frame_rounding = _config.FrameRounding >= 0
-        ? height * _config.FrameRounding
+    const float frame_rounding = _config->FrameRounding >= 0
+        ? height * _config->FrameRounding
         : height * 0.5f;
 
+    ImGuiToggleMeshPart parts[3];
+    int part_count = 0;
+
     // draw frame shadow, if enabled
-    if (HasShadowedFrame())
+    if (HasShadowedFrame<Features>())
     {
-        const ImU32 color_frame_shadow = ImGui::GetColorU32(_palette.FrameShadow);
-        DrawRectShadow(_boundingBox, color_frame_shadow, frame_rounding, _state.FrameShadowThickness);
+        const ImU32 color_frame_shadow = _palette.FrameShadow;
+        parts[part_count++] = RectShadowPart(_boundingBox, color_frame_shadow, frame_rounding, _state.FrameShadowThickness);
     }
 
     // draw frame background
-    _drawList->AddRectFilled(_boundingBox.Min, _boundingBox.Max, color_frame, frame_rounding);
+    parts[part_count++] = RectFilledPart(_boundingBox, color_frame, frame_rounding);
 
     // draw frame border, if enabled
-    if (HasBorderedFrame())
+    if (HasBorderedFrame<Features>())
     {
-        const ImU32 color_frame_border = ImGui::GetColorU32(_palette.FrameBorder);
-        DrawRectBorder(_boundingBox, color_frame_border, frame_rounding, _state.FrameBorderThickness);
+        const ImU32 color_frame_border = _palette.FrameBorder;
+        parts[part_count++] = RectBorderPart(_boundingBox, color_frame_border, frame_rounding, _state.FrameBorderThickness);
     }
+
+    DrawParts(parts, part_count);
 }
 
 void ImGuiToggleRenderer::DrawA11yDot(const ImVec2& pos, ImU32 color)
@@ -243,14 +664,20 @@ void ImGuiToggleRenderer::DrawA11yGlyph(ImVec2 pos, ImU32 color, bool state, flo
         const float o_radius = radius - o_adjustment;
         const float o_thickness = thickness + o_adjustment;
         pos.x += o_adjustment;
-        _drawList->AddCircle(pos, o_radius, color, 0, o_thickness);
+
+        // drawn through the mesh cache, so it can be drawn with a sprite.
+        ImGuiToggleMeshPart part;
+        ImGui::InitToggleMeshKey(&part.Key, _drawList, ImGuiToggleMeshShape_CircleStroke, ImVec2(o_radius, 0.0f), 0.0f, o_thickness);
+        part.Origin = pos;
+        part.Color = color;
+        _context->MeshCache.DrawParts(_drawList, &part, 1, true);
     }
 }
 
 void ImGuiToggleRenderer::DrawA11yLabel(ImVec2 pos, ImU32 color, const char* label)
 {
     // subtract out half the sizes of the text to center them
-    const ImVec2 text_size = ImGui::CalcTextSize(label);
+    const ImVec2 text_size = _context->LabelCache.Measure(label, false).Size;
     pos.x -= (text_size.x * 0.5f);
     pos.y -= (text_size.y * 0.5f);
 
@@ -279,13 +706,13 @@ void ImGuiToggleRenderer::DrawA11yFrameOverlay(float knob_radius, bool state)
     pos += adjustment;
 
     const ImU32 color = state
-        ? ImGui::GetColorU32(_colorA11yGlyphOn)
-        : ImGui::GetColorU32(_colorA11yGlyphOff);
+        ? _colorA11yGlyphOn
+        : _colorA11yGlyphOff;
 
-    switch (_config.A11yStyle)
+    switch (_config->A11yStyle)
     {
     case ImGuiToggleA11yStyle_Label:
-        DrawA11yLabel(pos, color, state ? _config.On.Label : _config.Off.Label);
+        DrawA11yLabel(pos, color, state ? _config->On.Label : _config->Off.Label);
         break;
     case ImGuiToggleA11yStyle_Glyph:
         DrawA11yGlyph(pos, color, state, radius, thickness);
@@ -304,6 +731,7 @@ void ImGuiToggleRenderer::DrawA11yFrameOverlays(float knob_radius)
     DrawA11yFrameOverlay(knob_radius, false);
 }
 
+template<ImGuiToggleFlags Features>
 void ImGuiToggleRenderer::DrawCircleKnob(float radius, ImU32 color_knob)
 {
     const float inset_size = ImMin(_state.KnobInset.GetAverage(), radius);
@@ -312,52 +740,76 @@ void ImGuiToggleRenderer::DrawCircleKnob(float radius, ImU32 color_knob)
     const ImVec2 knob_center = CalculateKnobCenter(radius, _animationPercent, _state.KnobOffset);
     const float knob_radius = radius - inset_size;
 
+    ImGuiToggleMeshPart parts[3];
+    int part_count = 0;
+
     // draw knob shadow, if enabled
-    if (HasShadowedKnob())
+    if (HasShadowedKnob<Features>())
     {
-        const ImU32 color_knob_shadow = ImGui::GetColorU32(_palette.KnobShadow);
-        DrawCircleShadow(knob_center, knob_radius, color_knob_shadow, _state.KnobShadowThickness);
+        const ImU32 color_knob_shadow = _palette.KnobShadow;
+        parts[part_count++] = CircleShadowPart(knob_center, knob_radius, color_knob_shadow, _state.KnobShadowThickness);
     }
 
     // draw circle knob
-    _drawList->AddCircleFilled(knob_center, knob_radius, color_knob);
+    parts[part_count++] = CircleFilledPart(knob_center, knob_radius, color_knob);
 
     // draw knob border, if enabled
-    if (HasBorderedKnob())
+    if (HasBorderedKnob<Features>())
     {
-        const ImU32 color_knob_border = ImGui::GetColorU32(_palette.KnobBorder);
-        DrawCircleBorder(knob_center, knob_radius, color_knob_border, _state.KnobBorderThickness);
+        const ImU32 color_knob_border = _palette.KnobBorder;
+        parts[part_count++] = CircleBorderPart(knob_center, knob_radius, color_knob_border, _state.KnobBorderThickness);
     }
+
+    DrawParts(parts, part_count);
 }
 
+template<ImGuiToggleFlags Features>
 void ImGuiToggleRenderer::DrawRectangleKnob(float radius, ImU32 color_knob)
 {
     const ImRect bounds = CalculateKnobBounds(radius, _animationPercent, _state.KnobOffset);
 
     const float knob_diameter_total = bounds.GetHeight();
-    const float knob_rounded_radius = (knob_diameter_total * 0.5f) * _config.KnobRounding;
+    const float knob_rounded_radius = (knob_diameter_total * 0.5f) * _config->KnobRounding;
+
+    ImGuiToggleMeshPart parts[3];
+    int part_count = 0;
 
     // draw knob shadow, if enabled
-    if (HasShadowedKnob())
+    if (HasShadowedKnob<Features>())
     {
-        const ImU32 color_knob_shadow = ImGui::GetColorU32(_palette.KnobShadow);
-        DrawRectShadow(bounds, color_knob_shadow, _config.KnobRounding, _state.KnobShadowThickness);
+        const ImU32 color_knob_shadow = _palette.KnobShadow;
+        parts[part_count++] = RectShadowPart(bounds, color_knob_shadow, _config->KnobRounding, _state.KnobShadowThickness);
     }
 
     // draw rectangle/squircle knob 
-    _drawList->AddRectFilled(bounds.Min, bounds.Max, color_knob, knob_rounded_radius);
+    parts[part_count++] = RectFilledPart(bounds, color_knob, knob_rounded_radius);
 
     // draw knob border, if enabled
-    if (HasBorderedKnob())
+    if (HasBorderedKnob<Features>())
     {
-        const ImU32 color_knob_border = ImGui::GetColorU32(_palette.KnobBorder);
-        DrawRectBorder(bounds, color_knob_border, knob_rounded_radius, _state.KnobBorderThickness);
+        const ImU32 color_knob_border = _palette.KnobBorder;
+        parts[part_count++] = RectBorderPart(bounds, color_knob_border, knob_rounded_radius, _state.KnobBorderThickness);
     }
+
+    DrawParts(parts, part_count);
+}
+
+void ImGuiToggleRenderer::DrawLed(ImU32 color_frame, ImU32 color_knob, float radius)
+{
+    // without rounding, each rectangle is a single quad with no anti-aliased fringe.
+    const ImRect knob_bounds = CalculateKnobBounds(radius, _animationPercent, _state.KnobOffset);
+
+    ImGuiToggleMeshPart parts[2];
+    parts[0] = RectFilledPart(_boundingBox, color_frame, 0.0f);
+    parts[1] = RectFilledPart(knob_bounds, color_knob, 0.0f);
+    DrawParts(parts, 2);
 }
 
 void ImGuiToggleRenderer::DrawLabel(float x_offset)
 {
-    const ImVec2 label_size = ImGui::CalcTextSize(_label, nullptr, true);
+    IMGUI_TOGGLE_PROFILE_SCOPE("ImGuiToggleRenderer::DrawLabel");
+    // the label was measured during layout, in `Render()`.
+    const ImVec2 label_size = _labelSize;
 
     const float half_height = GetHeight() * 0.5f;
     const float label_x = _boundingBox.Max.x + _style->ItemInnerSpacing.x + x_offset;
@@ -367,15 +819,16 @@ void ImGuiToggleRenderer::DrawLabel(float x_offset)
     ImGuiContext& g = *GImGui;
     if (g.LogEnabled)
     {
-        ImGui::LogRenderedText(&label_pos, _isMixedValue ? "[~]" : *_value ? "[x]" : "[ ]");
+        ImGui::LogRenderedText(&label_pos, _isMixedValue ? "[~]" : _value ? "[x]" : "[ ]");
     }
 
     if (label_size.x > 0.0f)
     {
-        ImGui::RenderText(label_pos, _label);
+        ImGui::RenderText(label_pos, _label, _labelEnd, false);
     }
 }
 
+template<ImGuiToggleFlags Features>
 void ImGuiToggleRenderer::UpdateAnimationPercent()
 {
     // calculate the lerp percentage for animation,
@@ -383,45 +836,64 @@ void ImGuiToggleRenderer::UpdateAnimationPercent()
     // or 0.5f if we have a mixed value. Also, trying to keep parity with
     // undocumented tristate/mixed/indeterminate checkbox (#2644)
 
-    float t = _isMixedValue
+    const float t = _isMixedValue
         ? 0.5f
-        : (*_value ? 1.0f : 0.0f);
+        : (_value ? 1.0f : 0.0f);
+
+    _animationPercent = t;
 
-    if (IsAnimated() && _isLastActive)
+    if (!IsAnimated<Features>())
     {
-        const float t_anim = ImSaturate(ImInvLerp(0.0f, _config.AnimationDuration, _lastActiveTimer));
-        t = *_value ? (t_anim) : (1.0f - t_anim);
+        return;
     }
 
-    _animationPercent = t;
+    ImGuiContext& g = *GImGui;
+    ImGuiToggleAnimationPool& animations = _context->Animations;
+
+    // remember the value each toggle was last drawn with, so a change from anywhere
+    // (a click, or the value being set in code) starts an animation towards the new value.
+    float* last_t = g.CurrentWindow->StateStorage.GetFloatRef(_id, t);
+    if (*last_t != t)
+    {
+        // if the toggle was already animating, carry on from where it was.
+        float from = *last_t;
+        animations.Sample(_id, g.Time, &from);
+        animations.Start(_id, from, t, g.Time, _config->AnimationDuration * ImAbs(t - from));
+        *last_t = t;
+    }
+
+    if (animations.Sample(_id, g.Time, &_animationPercent))
+    {
+        IMGUI_TOGGLE_STATS_ADD(_context->Stats.Current, AnimatingCount, 1);
+    }
 }
 
+template<ImGuiToggleFlags Features>
 void ImGuiToggleRenderer::UpdateStateConfig()
 {
-    if (!IsAnimated())
+    IMGUI_TOGGLE_PROFILE_SCOPE("ImGuiToggleRenderer::UpdateStateConfig");
+    if (!IsAnimated<Features>())
     {
-        _state = *_value ? _config.On : _config.Off;
+        _state = _value ? _config->On : _config->Off;
         return;
     }
 
-    _state.FrameBorderThickness = ImLerp(_config.Off.FrameBorderThickness, _config.On.FrameBorderThickness, _animationPercent);
-    _state.KnobBorderThickness = ImLerp(_config.Off.KnobBorderThickness, _config.On.KnobBorderThickness, _animationPercent);
-    _state.KnobInset = ImLerp(_config.Off.KnobInset, _config.On.KnobInset, _animationPercent);
-    _state.KnobOffset = ImLerp(_config.Off.KnobOffset, _config.On.KnobOffset, _animationPercent);
+    _state.FrameBorderThickness = ImLerp(_config->Off.FrameBorderThickness, _config->On.FrameBorderThickness, _animationPercent);
+    _state.KnobBorderThickness = ImLerp(_config->Off.KnobBorderThickness, _config->On.KnobBorderThickness, _animationPercent);
+    _state.KnobInset = ImLerp(_config->Off.KnobInset, _config->On.KnobInset, _animationPercent);
+    _state.KnobOffset = ImLerp(_config->Off.KnobOffset, _config->On.KnobOffset, _animationPercent);
 }
 
+template<ImGuiToggleFlags Features>
 void ImGuiToggleRenderer::UpdatePalette()
 {
-    const ImGuiTogglePalette* on_candidate = _config.On.Palette;
-    const ImGuiTogglePalette* off_candidate = _config.Off.Palette;
+    IMGUI_TOGGLE_PROFILE_SCOPE("ImGuiToggleRenderer::UpdatePalette");
+    // the palettes are resolved against the style once, and reused until the candidates or style change.
+    const ImGuiTogglePaletteCacheEntry& palettes = _context->PaletteCache.Resolve(_config->On.Palette, _config->Off.Palette, *_style);
 
-    if (!IsAnimated())
+    if (!IsAnimated<Features>())
     {
-        ImGui::UnionPalette(
-            &_palette,
-            *_value ? on_candidate : off_candidate,
-            _style->Colors,
-            *_value);
+        _palette = _value ? palettes.On : palettes.Off;
 
         // store specific colors that shouldn't blend.
         _colorA11yGlyphOff = _palette.A11yGlyph;
@@ -430,17 +902,54 @@ void ImGuiToggleRenderer::UpdatePalette()
         return;
     }
 
-    ImGuiTogglePalette off_unioned;
-    ImGuiTogglePalette on_unioned;
-    ImGui::UnionPalette(&off_unioned, off_candidate, _style->Colors, false);
-    ImGui::UnionPalette(&on_unioned, on_candidate, _style->Colors, true);
-
     // otherwise, lets lerp them!
-    ImGui::BlendPalettes(&_palette, off_unioned, on_unioned, _animationPercent);
+    ImGui::BlendResolvedPalettesN(&_palette, palettes.Off, palettes.On, &_animationPercent, 1);
+    IMGUI_TOGGLE_STATS_ADD(_context->Stats.Current, PaletteBlendCount, 1);
 
     // store specific colors that shouldn't blend.
-    _colorA11yGlyphOff = off_unioned.A11yGlyph;
-    _colorA11yGlyphOn = on_unioned.A11yGlyph;
+    _colorA11yGlyphOff = palettes.Off.A11yGlyph;
+    _colorA11yGlyphOn = palettes.On.A11yGlyph;
+}
+
+ImVec2 ImGuiToggleRenderer::CalculateToggleSize(const ImGuiToggleConfig& config) const
+{
+    // the config may not be validated yet, so clamp the width ratio just as validating would.
+    const float height = config.Size.y > 0
+        ? config.Size.y
+        : ImGui::GetFrameHeight();
+    const float width = config.Size.x > 0
+        ? config.Size.x
+        : height * ImClamp(config.WidthRatio, WidthRatioMinimum, WidthRatioMaximum);
+
+    return ImVec2(width, height);
+}
+
+float ImGuiToggleRenderer::CalculateLabelOffsetX(const ImGuiToggleConfig& config)
+{
+    return ImMax(0.0f, -config.On.KnobOffset.x / 2.0f);
+}
+
+ImGuiToggleLod ImGuiToggleRenderer::CalculateLod() const
+{
+    // a disabled threshold of 0 is never reached, as no toggle is shorter than that.
+    const float height = GetHeight();
+
+    if (height < _config->LodLedHeight)
+    {
+        return ImGuiToggleLod_Led;
+    }
+
+    if (height < _config->LodCoarseHeight)
+    {
+        return ImGuiToggleLod_Coarse;
+    }
+
+    if (height < _config->LodSimpleHeight)
+    {
+        return ImGuiToggleLod_Simple;
+    }
+
+    return ImGuiToggleLod_Full;
 }
 
 ImVec2 ImGuiToggleRenderer::CalculateKnobCenter(float radius, float animation_percent, const ImVec2& offset /*= ImVec2()*/) const
@@ -483,43 +992,96 @@ ImRect ImGuiToggleRenderer::CalculateKnobBounds(float radius, float animation_pe
     return ImRect(knob_min, knob_max);
 }
 
-void ImGuiToggleRenderer::DrawRectBorder(ImRect bounds, ImU32 color_border, float rounding, float thickness)
+void ImGuiToggleRenderer::DrawParts(const ImGuiToggleMeshPart* parts, int part_count)
+{
+    // shapes are only remembered once the toggle has settled, as a moving animation would fill the cache with in-between sizes.
+    const bool is_settled = _isMixedValue || _animationPercent == 0.0f || _animationPercent == 1.0f;
+
+    // in a batch, record the shapes to draw later. A11y overlays are drawn between the frame and knob, so those toggles can't be deferred.
+    ImGuiToggleBatch& batch = _context->Batch;
+    if (batch.DrawList == _drawList && !HasA11yGlyphs())
+    {
+        batch.AddParts(parts, part_count, is_settled);
+        return;
+    }
+
+    _context->MeshCache.DrawParts(_drawList, parts, part_count, is_settled);
+}
+
+ImGuiToggleMeshPart ImGuiToggleRenderer::RectFilledPart(const ImRect& bounds, ImU32 color, float rounding) const
+{
+    ImGuiToggleMeshPart part;
+    ImGui::InitToggleMeshKey(&part.Key, _drawList, ImGuiToggleMeshShape_RectFilled, bounds.GetSize(), rounding);
+    part.Origin = bounds.Min;
+    part.Color = color;
+    return part;
+}
+
+ImGuiToggleMeshPart ImGuiToggleRenderer::CircleFilledPart(const ImVec2& center, float radius, ImU32 color) const
+{
+    ImGuiToggleMeshPart part;
+    ImGui::InitToggleMeshKey(&part.Key, _drawList, ImGuiToggleMeshShape_CircleFilled, ImVec2(radius, 0.0f));
+    part.Origin = center;
+    part.Color = color;
+
+    // at coarse detail, circles get half the segments the draw list would give them.
+    if (_lod >= ImGuiToggleLod_Coarse)
+    {
+        part.Key.CircleSegments = ImMax(_drawList->_CalcCircleAutoSegmentCount(radius) / 2, ::LodCircleSegmentsMinimum);
+    }
+
+    return part;
+}
+
+ImGuiToggleMeshPart ImGuiToggleRenderer::RectBorderPart(ImRect bounds, ImU32 color_border, float rounding, float thickness) const
 {
     // the border should only grow "inside" the bounding box,
     // so we need to shrink the bounds used to prevent it from puffing out.
     const float half_thickness = thickness * 0.5f;
     bounds.Expand(-half_thickness);
 
-    _drawList->AddRect(bounds.Min, bounds.Max, color_border, rounding, ImDrawFlags_None, thickness);
+    ImGuiToggleMeshPart part;
+    ImGui::InitToggleMeshKey(&part.Key, _drawList, ImGuiToggleMeshShape_RectStroke, bounds.GetSize(), rounding, thickness);
+    part.Origin = bounds.Min;
+    part.Color = color_border;
+    return part;
 }
 
-void ImGuiToggleRenderer::DrawCircleBorder(const ImVec2& center, float radius, ImU32 color_border, float thickness)
+ImGuiToggleMeshPart ImGuiToggleRenderer::CircleBorderPart(const ImVec2& center, float radius, ImU32 color_border, float thickness) const
 {
     // the border should only grow "inside" the bounding box,
     // so we need to shrink the radius used to prevent it from puffing out.
     const float half_thickness = thickness * 0.5f;
     radius -= half_thickness;
 
-    _drawList->AddCircle(center, radius, color_border, 0, thickness);
+    ImGuiToggleMeshPart part;
+    ImGui::InitToggleMeshKey(&part.Key, _drawList, ImGuiToggleMeshShape_CircleStroke, ImVec2(radius, 0.0f), 0.0f, thickness);
+    part.Origin = center;
+    part.Color = color_border;
+    return part;
 }
 
-
-void ImGuiToggleRenderer::DrawRectShadow(ImRect bounds, ImU32 color_shadow, float rounding, float thickness)
+ImGuiToggleMeshPart ImGuiToggleRenderer::RectShadowPart(const ImRect& bounds, ImU32 color_shadow, float rounding, float thickness) const
 {
-    // the shadow should only grow "outside" the bounding box,
-    // so we need to expand the bounds used to puff it out.
-    const float half_thickness = thickness * 0.5f;
-    bounds.Expand(half_thickness);
-
-    _drawList->AddRect(bounds.Min, bounds.Max, color_shadow, rounding, ImDrawFlags_None, thickness);
+    // the shadow only grows "outside" the bounding box, which the shape takes care of.
+    ImGuiToggleMeshPart part;
+    ImGui::InitToggleMeshKey(&part.Key, _drawList, ImGuiToggleMeshShape_RectShadow, bounds.GetSize(), rounding, thickness);
+    part.Origin = bounds.Min;
+    part.Color = color_shadow;
+    return part;
 }
 
-void ImGuiToggleRenderer::DrawCircleShadow(const ImVec2& center, float radius, ImU32 color_border, float thickness)
+ImGuiToggleMeshPart ImGuiToggleRenderer::CircleShadowPart(const ImVec2& center, float radius, ImU32 color_shadow, float thickness) const
 {
-    // the shadow should only grow "outside" the bounding box,
-    // so we need to expand the radius used to puff it out.
-    const float half_thickness = thickness * 0.5f;
-    radius += half_thickness;
-
-    _drawList->AddCircle(center, radius, color_border, 0, thickness);
+    // the shadow only grows "outside" the radius, which the shape takes care of.
+    ImGuiToggleMeshPart part;
+    ImGui::InitToggleMeshKey(&part.Key, _drawList, ImGuiToggleMeshShape_CircleShadow, ImVec2(radius, 0.0f), 0.0f, thickness);
+    part.Origin = center;
+    part.Color = color_shadow;
+    return part;
 }
+
+// instantiate `Render()` for every combination of flags, so `ImGui::Toggle<Flags>()` can use any of them.
+#define IMGUI_TOGGLE_INSTANTIATE_RENDER(flags) template bool ImGuiToggleRenderer::Render<(flags)>();
+IMGUI_TOGGLE_FOR_EACH_FLAGS(IMGUI_TOGGLE_INSTANTIATE_RENDER)
+#undef IMGUI_TOGGLE_INSTANTIATE_RENDER
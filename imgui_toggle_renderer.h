@@ -7,66 +7,182 @@
 #include "imgui_internal.h"
 
 #include "imgui_toggle.h"
+#include "imgui_toggle_events.h"
+#include "imgui_toggle_mesh.h"
 #include "imgui_toggle_palette.h"
+#include "imgui_toggle_retained.h"
 
+struct ImGuiToggleContext;
 
+// ImGuiToggleLod: How much detail a toggle is drawn with, picked from its height and the config's level of detail thresholds.
+enum ImGuiToggleLod
+{
+    ImGuiToggleLod_Full,                    // Everything the config asks for.
+    ImGuiToggleLod_Simple,                  // No shadows, borders, or A11y glyphs.
+    ImGuiToggleLod_Coarse,                  // As simple, with round knobs drawn with fewer segments.
+    ImGuiToggleLod_Led,                     // A square frame and knob, two quads without anti-aliasing.
+};
+
+// ImGuiToggleBindingType: What kind of storage a toggle's value is bound to.
+enum ImGuiToggleBindingType
+{
+    ImGuiToggleBindingType_None,
+    ImGuiToggleBindingType_Bool,            // A bool.
+    ImGuiToggleBindingType_Bit32,           // A bit of an ImU32 word.
+    ImGuiToggleBindingType_Bit64,           // A bit of an ImU64 word.
+    ImGuiToggleBindingType_Atomic,          // A std::atomic<bool>.
+    ImGuiToggleBindingType_Accessors,       // A getter and setter.
+};
+
+// ImGuiToggleBinding: Where a toggle's value is stored. The renderer reads it once as the toggle is drawn, and writes it back only when pressed.
+struct ImGuiToggleBinding
+{
+    ImGuiToggleBindingType Type = ImGuiToggleBindingType_None;
+    void* Data = nullptr;                   // The bool, the word, the atomic, or the accessors' user data.
+    ImU64 Mask = 0;                         // The bit within the word.
+    ImGuiToggleGetter Getter = nullptr;
+    ImGuiToggleSetter Setter = nullptr;
+
+    static ImGuiToggleBinding FromBool(bool* value) { ImGuiToggleBinding binding; binding.Type = ImGuiToggleBindingType_Bool; binding.Data = value; return binding; }
+    static ImGuiToggleBinding FromBit(ImU32* word, int bit) { ImGuiToggleBinding binding; binding.Type = ImGuiToggleBindingType_Bit32; binding.Data = word; binding.Mask = (ImU64)1 << bit; return binding; }
+    static ImGuiToggleBinding FromBit(ImU64* word, int bit) { ImGuiToggleBinding binding; binding.Type = ImGuiToggleBindingType_Bit64; binding.Data = word; binding.Mask = (ImU64)1 << bit; return binding; }
+    static ImGuiToggleBinding FromAtomic(std::atomic<bool>* value) { ImGuiToggleBinding binding; binding.Type = ImGuiToggleBindingType_Atomic; binding.Data = value; return binding; }
+    static ImGuiToggleBinding FromAccessors(ImGuiToggleGetter getter, ImGuiToggleSetter setter, void* user_data) { ImGuiToggleBinding binding; binding.Type = ImGuiToggleBindingType_Accessors; binding.Data = user_data; binding.Getter = getter; binding.Setter = setter; return binding; }
+
+    inline bool IsBound() const { return Type != ImGuiToggleBindingType_None && (Type == ImGuiToggleBindingType_Accessors ? Getter != nullptr && Setter != nullptr : Data != nullptr); }
+
+    inline bool Read() const
+    {
+        switch (Type)
+        {
+        case ImGuiToggleBindingType_Bool: return *(bool*)Data;
+        case ImGuiToggleBindingType_Bit32: return (*(ImU32*)Data & (ImU32)Mask) != 0;
+        case ImGuiToggleBindingType_Bit64: return (*(ImU64*)Data & Mask) != 0;
+        case ImGuiToggleBindingType_Atomic: return ((std::atomic<bool>*)Data)->load(std::memory_order_acquire);
+        case ImGuiToggleBindingType_Accessors: return Getter(Data);
+        default: return false;
+        }
+    }
+
+    inline void Write(bool value) const
+    {
+        switch (Type)
+        {
+        case ImGuiToggleBindingType_Bool: *(bool*)Data = value; break;
+        case ImGuiToggleBindingType_Bit32: *(ImU32*)Data = value ? (*(ImU32*)Data | (ImU32)Mask) : (*(ImU32*)Data & ~(ImU32)Mask); break;
+        case ImGuiToggleBindingType_Bit64: *(ImU64*)Data = value ? (*(ImU64*)Data | Mask) : (*(ImU64*)Data & ~Mask); break;
+        case ImGuiToggleBindingType_Atomic: ((std::atomic<bool>*)Data)->store(value, std::memory_order_release); break;
+        case ImGuiToggleBindingType_Accessors: Setter(Data, value); break;
+        default: break;
+        }
+    }
+};
+
+// calls `X(flags)` for each of the 64 combinations of ImGuiToggleFlags_ bits, to instantiate templates taking flags.
+#define IMGUI_TOGGLE_FOR_EACH_FLAGS_1(X, flags) X(flags) X((flags) | ImGuiToggleFlags_Animated)
+#define IMGUI_TOGGLE_FOR_EACH_FLAGS_2(X, flags) IMGUI_TOGGLE_FOR_EACH_FLAGS_1(X, flags) IMGUI_TOGGLE_FOR_EACH_FLAGS_1(X, (flags) | ImGuiToggleFlags_BorderedFrame)
+#define IMGUI_TOGGLE_FOR_EACH_FLAGS_3(X, flags) IMGUI_TOGGLE_FOR_EACH_FLAGS_2(X, flags) IMGUI_TOGGLE_FOR_EACH_FLAGS_2(X, (flags) | ImGuiToggleFlags_BorderedKnob)
+#define IMGUI_TOGGLE_FOR_EACH_FLAGS_4(X, flags) IMGUI_TOGGLE_FOR_EACH_FLAGS_3(X, flags) IMGUI_TOGGLE_FOR_EACH_FLAGS_3(X, (flags) | ImGuiToggleFlags_ShadowedFrame)
+#define IMGUI_TOGGLE_FOR_EACH_FLAGS_5(X, flags) IMGUI_TOGGLE_FOR_EACH_FLAGS_4(X, flags) IMGUI_TOGGLE_FOR_EACH_FLAGS_4(X, (flags) | ImGuiToggleFlags_ShadowedKnob)
+#define IMGUI_TOGGLE_FOR_EACH_FLAGS_6(X, flags) IMGUI_TOGGLE_FOR_EACH_FLAGS_5(X, flags) IMGUI_TOGGLE_FOR_EACH_FLAGS_5(X, (flags) | ImGuiToggleFlags_A11y)
+#define IMGUI_TOGGLE_FOR_EACH_FLAGS(X) IMGUI_TOGGLE_FOR_EACH_FLAGS_6(X, ImGuiToggleFlags_None)
+
+// ImGuiToggleRenderer: Lays out, handles input for, and draws toggles.
+//   The drawing functions take `Features`, the flags that may be enabled. A feature is drawn only if it is in both `Features`
+//   and the config's flags, so features known at compile time not to be used are compiled out. The default allows every feature.
+//   Each renderer belongs to one ImGuiToggleContext, and draws only into that context.
 class ImGuiToggleRenderer
 {
 public:
-    ImGuiToggleRenderer();
-    ImGuiToggleRenderer(const char* label, bool* value, const ImGuiToggleConfig& user_config);
-    void SetConfig(const char* label, bool* value, const ImGuiToggleConfig& user_config);
-    bool Render();
+    explicit ImGuiToggleRenderer(ImGuiToggleContext* context);
+    // Sets up the renderer to draw one toggle. Unlike `SetConfig()`, the config is copied and validated right away, so it needn't outlive the renderer.
+    ImGuiToggleRenderer(ImGuiToggleContext* context, const char* label, bool* value, const ImGuiToggleConfig& user_config);
+    // Sets the toggle to draw next, and where its value is stored. The config is only referenced until `Render()` or `RenderGrid()`, which copy it once they know it's needed.
+    void SetConfig(const char* label, const ImGuiToggleBinding& binding, const ImGuiToggleConfig& user_config);
+    // Sets the toggle to draw next with a config compiled ahead of time, which is only referenced: it's neither copied nor validated again.
+    void SetCompiledConfig(const char* label, const ImGuiToggleBinding& binding, const ImGuiToggleCompiledConfig& compiled_config);
+    // Draws the next toggle with an interned label and an ID known ahead of time, rather than hashing and measuring its label. Call after setting its config.
+    void SetInternedLabel(ImGuiID id, const ImGuiToggleLabel& label) { _internedId = id; _internedLabel = &label; _label = label.Text; }
+    void SetFlags(ImGuiToggleFlags flags) { _fixedFlags = flags; _hasFixedFlags = true; }
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> bool Render();
+    bool RenderGrid(ImU64* bits, int count, int columns);
+
+    // Copies and validates `config` into `compiled`, drawing with `flags` in place of `config.Flags`, and derives what's drawn from it.
+    static void CompileConfig(ImGuiToggleCompiledConfig* compiled, const ImGuiToggleConfig& config, ImGuiToggleFlags flags);
 
 private:
     // toggle state & context
-    ImGuiToggleConfig _config;
+    const ImGuiToggleConfig* _userConfig;
+    ImGuiToggleFlags _fixedFlags;
+    bool _hasFixedFlags;
+    ImGuiToggleCompiledConfig _compiledStorage;         // The user's config, once compiled by ApplyConfig().
+    const ImGuiToggleCompiledConfig* _compiled;         // The config being drawn: the user's compiled config, or _compiledStorage.
+    const ImGuiToggleConfig* _config;                   // Always `&_compiled->Config`.
     ImGuiToggleStateConfig _state;
-    ImGuiTogglePalette _palette;
+    ImGuiToggleResolvedPalette _palette;
 
     bool _isMixedValue;
     bool _isHovered;
-    bool _isLastActive;
-    float _lastActiveTimer;
     float _animationPercent;
+    ImGuiToggleLod _lod;
 
     // imgui specific context
+    ImGuiToggleContext* _context;
     const ImGuiStyle* _style;
     ImDrawList* _drawList;
     ImGuiID _id;
 
     // raw ui value & label
     const char* _label;
-    bool* _value;
+    ImGuiToggleBinding _binding;
+    bool _value;                                        // The bound value, read once per toggle drawn.
 
     // calculated values
     ImRect _boundingBox;
-    ImVec4 _colorA11yGlyphOff;
-    ImVec4 _colorA11yGlyphOn;
+    ImVec2 _labelSize;
+    const char* _labelEnd;
+    const ImGuiToggleLabel* _internedLabel;             // Set by SetInternedLabel() for the next toggle, along with its ID.
+    ImGuiID _internedId;
+    ImU32 _colorA11yGlyphOff;
+    ImU32 _colorA11yGlyphOn;
+
+    // the visible grid toggles that are animating, sampled and blended all at once before the grid is drawn.
+    ImVector<int> _gridAnimatingIndices;
+    ImVector<float> _gridAnimatingPercents;
+    ImVector<ImGuiToggleResolvedPalette> _gridAnimatingPalettes;
 
     // inline accessors
     inline float GetWidth() const { return _boundingBox.GetWidth(); }
     inline float GetHeight() const { return _boundingBox.GetHeight(); }
     inline ImVec2 GetPosition() const { return _boundingBox.Min; }
     inline ImVec2 GetToggleSize() const { return _boundingBox.GetSize(); }
-    inline bool IsAnimated() const { return (_config.Flags & ImGuiToggleFlags_Animated) != 0 && _config.AnimationDuration > 0; }
-    inline bool HasBorderedFrame() const { return (_config.Flags & ImGuiToggleFlags_BorderedFrame) != 0 && _state.FrameBorderThickness > 0; }
-    inline bool HasShadowedFrame() const { return (_config.Flags & ImGuiToggleFlags_ShadowedFrame) != 0 && _state.FrameShadowThickness > 0; }
-    inline bool HasBorderedKnob() const { return (_config.Flags & ImGuiToggleFlags_BorderedKnob) != 0 && _state.KnobBorderThickness > 0; }
-    inline bool HasShadowedKnob() const { return (_config.Flags & ImGuiToggleFlags_ShadowedKnob) != 0 && _state.KnobShadowThickness > 0; }
-    inline bool HasA11yGlyphs() const { return (_config.Flags & ImGuiToggleFlags_A11y) != 0; }
-    inline bool HasCircleKnob() const { return _config.KnobRounding >= 1.0f; }
-    inline bool HasRectangleKnob() const { return _config.KnobRounding < 1.0f; }
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> inline bool HasFeature(ImGuiToggleFlags flag) const { return (Features & flag) != 0 && (_config->Flags & flag) != 0; }
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> inline bool IsAnimated() const { return (Features & ImGuiToggleFlags_Animated) != 0 && _compiled->IsAnimated; }
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> inline bool HasBorderedFrame() const { return HasFeature<Features>(ImGuiToggleFlags_BorderedFrame) && _state.FrameBorderThickness > 0 && IsFullDetail(); }
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> inline bool HasShadowedFrame() const { return HasFeature<Features>(ImGuiToggleFlags_ShadowedFrame) && _state.FrameShadowThickness > 0 && IsFullDetail(); }
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> inline bool HasBorderedKnob() const { return HasFeature<Features>(ImGuiToggleFlags_BorderedKnob) && _state.KnobBorderThickness > 0 && IsFullDetail(); }
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> inline bool HasShadowedKnob() const { return HasFeature<Features>(ImGuiToggleFlags_ShadowedKnob) && _state.KnobShadowThickness > 0 && IsFullDetail(); }
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> inline bool HasA11yGlyphs() const { return HasFeature<Features>(ImGuiToggleFlags_A11y) && IsFullDetail(); }
+    inline bool IsFullDetail() const { return _lod == ImGuiToggleLod_Full; }
+    inline bool HasCircleKnob() const { return _compiled->HasCircleKnob; }
+    inline bool HasRectangleKnob() const { return !_compiled->HasCircleKnob; }
 
     // behavior
-    void ValidateConfig();
+    void ApplyConfig();
+    static void ValidateConfig(ImGuiToggleConfig& config);
     bool ToggleBehavior(const ImRect& interaction_bounding_box);
+    void RecordEvent(ImGuiID id, bool value);
+
+    // retaining what was drawn
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> bool CanRetain() const;
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> void InitRetainedKey(ImGuiToggleRetainedKey* key) const;
 
     // drawing - general
-    void DrawToggle();
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> void DrawToggle();
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> void DrawToggleBody();
 
     // drawing - frame
-    void DrawFrame(ImU32 color_frame);
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> void DrawFrame(ImU32 color_frame);
 
     // drawing a11y
     void DrawA11yDot(const ImVec2& pos, ImU32 color);
@@ -76,22 +192,31 @@ private:
     void DrawA11yFrameOverlays(float knob_radius);
 
     // drawing - knob
-    void DrawCircleKnob(float radius, ImU32 color_knob);
-    void DrawRectangleKnob(float radius, ImU32 color_knob);
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> void DrawCircleKnob(float radius, ImU32 color_knob);
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> void DrawRectangleKnob(float radius, ImU32 color_knob);
+
+    // drawing - level of detail
+    void DrawLed(ImU32 color_frame, ImU32 color_knob, float radius);
 
     // drawing - label
     void DrawLabel(float x_offset);
 
     // state updating
-    void UpdateAnimationPercent();
-    void UpdateStateConfig();
-    void UpdatePalette();
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> void UpdateAnimationPercent();
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> void UpdateStateConfig();
+    template<ImGuiToggleFlags Features = ImGuiToggleFlags_All> void UpdatePalette();
 
     // helpers
+    ImVec2 CalculateToggleSize(const ImGuiToggleConfig& config) const;
+    static float CalculateLabelOffsetX(const ImGuiToggleConfig& config);
+    ImGuiToggleLod CalculateLod() const;
     ImVec2 CalculateKnobCenter(float radius, float animation_percent, const ImVec2& offset = ImVec2()) const;
     ImRect CalculateKnobBounds(float radius, float animation_percent, const ImVec2& offset = ImVec2()) const;
-    void DrawRectBorder(ImRect bounds, ImU32 color_border, float rounding, float thickness);
-    void DrawCircleBorder(const ImVec2& center, float radius, ImU32 color_border, float thickness);
-    void DrawRectShadow(ImRect bounds, ImU32 color_shadow, float rounding, float thickness);
-    void DrawCircleShadow(const ImVec2& center, float radius, ImU32 color_shadow, float thickness);
+    void DrawParts(const ImGuiToggleMeshPart* parts, int part_count);
+    ImGuiToggleMeshPart RectFilledPart(const ImRect& bounds, ImU32 color, float rounding) const;
+    ImGuiToggleMeshPart CircleFilledPart(const ImVec2& center, float radius, ImU32 color) const;
+    ImGuiToggleMeshPart RectBorderPart(ImRect bounds, ImU32 color_border, float rounding, float thickness) const;
+    ImGuiToggleMeshPart CircleBorderPart(const ImVec2& center, float radius, ImU32 color_border, float thickness) const;
+    ImGuiToggleMeshPart RectShadowPart(const ImRect& bounds, ImU32 color_shadow, float rounding, float thickness) const;
+    ImGuiToggleMeshPart CircleShadowPart(const ImVec2& center, float radius, ImU32 color_shadow, float thickness) const;
 };
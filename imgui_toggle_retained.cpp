@@ -0,0 +1,193 @@
+#include "imgui_toggle_retained.h"
+
+namespace
+{
+    // the most toggles the cache will hold. past this, new toggles are drawn as usual until unused ones are evicted.
+    const int RetainedCacheCapacity = 4096;
+
+    // how many frames a toggle can go undrawn before it is evicted. this is also how often the cache checks for them.
+    const int RetainedCacheEvictionFrames = 60;
+
+    inline void FreeEntry(ImGuiToggleRetainedEntry& entry)
+    {
+        entry.Vertices.clear();
+        entry.Indices.clear();
+    }
+} // namespace
+
+ImGuiToggleRetainedCache::~ImGuiToggleRetainedCache()
+{
+    Clear();
+}
+
+bool ImGuiToggleRetainedCache::Draw(ImDrawList* draw_list, ImGuiID id, const ImGuiToggleRetainedKey& key, const ImVec2& origin, int frame_count)
+{
+    const int index = EntryIndices.GetInt(id, -1);
+    if (index < 0)
+    {
+        return false;
+    }
+
+    ImGuiToggleRetainedEntry& entry = Entries[index];
+    if (memcmp(&entry.Key, &key, sizeof(key)) != 0)
+    {
+        return false;
+    }
+
+    entry.LastFrameUsed = frame_count;
+    draw_list->PrimReserve(entry.Indices.Size, entry.Vertices.Size);
+
+    // drawn at the same place, the vertices are exactly as they were. otherwise, move them along with the toggle.
+    ImDrawVert* vertex_write = draw_list->_VtxWritePtr;
+    if (origin.x == entry.Origin.x && origin.y == entry.Origin.y)
+    {
+        memcpy(vertex_write, entry.Vertices.Data, (size_t)entry.Vertices.Size * sizeof(ImDrawVert));
+    }
+    else
+    {
+        const ImVec2 offset = origin - entry.Origin;
+        for (int i = 0; i < entry.Vertices.Size; ++i)
+        {
+            const ImDrawVert& vertex = entry.Vertices[i];
+            vertex_write[i].pos = vertex.pos + offset;
+            vertex_write[i].uv = vertex.uv;
+            vertex_write[i].col = vertex.col;
+        }
+    }
+
+    // likewise, the indices only need rebasing if other items drew a different number of vertices before the toggle.
+    ImDrawIdx* index_write = draw_list->_IdxWritePtr;
+    const unsigned int vertex_base = draw_list->_VtxCurrentIdx;
+    if (vertex_base == entry.VertexBase)
+    {
+        memcpy(index_write, entry.Indices.Data, (size_t)entry.Indices.Size * sizeof(ImDrawIdx));
+    }
+    else
+    {
+        for (int i = 0; i < entry.Indices.Size; ++i)
+        {
+            index_write[i] = (ImDrawIdx)(entry.Indices[i] - entry.VertexBase + vertex_base);
+        }
+    }
+
+    draw_list->_IdxWritePtr += entry.Indices.Size;
+    draw_list->_VtxWritePtr += entry.Vertices.Size;
+    draw_list->_VtxCurrentIdx += entry.Vertices.Size;
+    return true;
+}
+
+ImGuiToggleRetainedMark ImGuiToggleRetainedCache::Mark(const ImDrawList* draw_list) const
+{
+    ImGuiToggleRetainedMark mark;
+    mark.VertexStart = draw_list->VtxBuffer.Size;
+    mark.IndexStart = draw_list->IdxBuffer.Size;
+    mark.VertexBase = draw_list->_VtxCurrentIdx;
+    mark.CommandCount = draw_list->CmdBuffer.Size;
+    return mark;
+}
+
+void ImGuiToggleRetainedCache::Capture(const ImDrawList* draw_list, const ImGuiToggleRetainedMark& mark, ImGuiID id, const ImGuiToggleRetainedKey& key, const ImVec2& origin, int frame_count)
+{
+    const int vertex_count = draw_list->VtxBuffer.Size - mark.VertexStart;
+    const int index_count = draw_list->IdxBuffer.Size - mark.IndexStart;
+
+    // if the draw list had to start a new command, the indices don't all count from where we started, so skip it.
+    if (vertex_count <= 0 || draw_list->CmdBuffer.Size != mark.CommandCount || draw_list->_VtxCurrentIdx != mark.VertexBase + vertex_count)
+    {
+        return;
+    }
+
+    int index = EntryIndices.GetInt(id, -1);
+    if (index < 0)
+    {
+        if (Entries.Size >= ::RetainedCacheCapacity)
+        {
+            return;
+        }
+
+        index = Entries.Size;
+        EntryIndices.SetInt(id, index);
+        Entries.push_back(ImGuiToggleRetainedEntry());
+    }
+
+    ImGuiToggleRetainedEntry& entry = Entries[index];
+    entry.Id = id;
+    entry.LastFrameUsed = frame_count;
+    memcpy(&entry.Key, &key, sizeof(key));
+    entry.Origin = origin;
+    entry.VertexBase = mark.VertexBase;
+
+    entry.Vertices.resize(vertex_count);
+    entry.Indices.resize(index_count);
+    memcpy(entry.Vertices.Data, draw_list->VtxBuffer.Data + mark.VertexStart, (size_t)vertex_count * sizeof(ImDrawVert));
+    memcpy(entry.Indices.Data, draw_list->IdxBuffer.Data + mark.IndexStart, (size_t)index_count * sizeof(ImDrawIdx));
+}
+
+void ImGuiToggleRetainedCache::EvictUnused(int frame_count)
+{
+    if (frame_count - LastEvictionFrame < ::RetainedCacheEvictionFrames)
+    {
+        return;
+    }
+
+    LastEvictionFrame = frame_count;
+
+    // compact the entries that are still in use to the front, swapping their buffers rather than copying them.
+    int kept_count = 0;
+    for (int i = 0; i < Entries.Size; ++i)
+    {
+        ImGuiToggleRetainedEntry& entry = Entries[i];
+        if (frame_count - entry.LastFrameUsed >= ::RetainedCacheEvictionFrames)
+        {
+            ::FreeEntry(entry);
+            continue;
+        }
+
+        if (kept_count != i)
+        {
+            ImGuiToggleRetainedEntry& kept = Entries[kept_count];
+            kept.Id = entry.Id;
+            kept.LastFrameUsed = entry.LastFrameUsed;
+            memcpy(&kept.Key, &entry.Key, sizeof(entry.Key));
+            kept.Origin = entry.Origin;
+            kept.VertexBase = entry.VertexBase;
+            kept.Vertices.swap(entry.Vertices);
+            kept.Indices.swap(entry.Indices);
+        }
+
+        ++kept_count;
+    }
+
+    if (kept_count == Entries.Size)
+    {
+        return;
+    }
+
+    // free anything left behind past the kept entries.
+    for (int i = kept_count; i < Entries.Size; ++i)
+    {
+        ::FreeEntry(Entries[i]);
+    }
+
+    Entries.resize(kept_count);
+
+    // rebuild the indices in one go, rather than inserting them one at a time.
+    EntryIndices.Data.resize(kept_count);
+    for (int i = 0; i < kept_count; ++i)
+    {
+        EntryIndices.Data[i].key = Entries[i].Id;
+        EntryIndices.Data[i].val_i = i;
+    }
+    EntryIndices.BuildSortByKey();
+}
+
+void ImGuiToggleRetainedCache::Clear()
+{
+    for (int i = 0; i < Entries.Size; ++i)
+    {
+        ::FreeEntry(Entries[i]);
+    }
+
+    Entries.resize(0);
+    EntryIndices.Data.resize(0);
+}
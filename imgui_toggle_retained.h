@@ -0,0 +1,92 @@
+#pragma once
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif // IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+
+#include "imgui_toggle.h"
+#include "imgui_toggle_palette.h"
+
+// ImGuiToggleRetainedKey: Everything that changes what a toggle draws, other than its position.
+//   Two toggles with the same key draw the same vertices, only moved. It is compared as raw memory, so always clear it before filling it out.
+struct ImGuiToggleRetainedKey
+{
+    // the toggle.
+    ImVec2 Size;
+    float AnimationPercent;
+    bool IsHovered;
+    ImGuiToggleFlags Flags;                 // The features drawn: the config's flags, limited to the features compiled in.
+    int A11yStyle;
+    int Lod;                                // The ImGuiToggleLod the toggle is drawn at.
+    float FrameRounding;
+    float KnobRounding;
+
+    // its state, between off and on.
+    float FrameBorderThickness;
+    float FrameShadowThickness;
+    float KnobBorderThickness;
+    float KnobShadowThickness;
+    ImOffsetRect KnobInset;
+    ImVec2 KnobOffset;
+
+    // its colors.
+    ImGuiToggleResolvedPalette Palette;
+    ImU32 A11yGlyphOff;
+    ImU32 A11yGlyphOn;
+
+    // draw list settings that change tessellation.
+    ImDrawListFlags DrawListFlags;
+    float FringeScale;
+    float CircleSegmentMaxError;
+    float FontSize;
+    ImVec2 TexUvWhitePixel;
+    ImTextureID TextureId;
+};
+
+// ImGuiToggleRetainedMark: Where a draw list's buffers ended before a toggle was drawn, to find what the toggle drew.
+struct ImGuiToggleRetainedMark
+{
+    int VertexStart;                        // Offset into the draw list's VtxBuffer.
+    int IndexStart;                         // Offset into the draw list's IdxBuffer.
+    unsigned int VertexBase;                // The draw list vertex index of the first vertex drawn.
+    int CommandCount;
+};
+
+// ImGuiToggleRetainedEntry: The vertices and indices a toggle drew, as they were written into the draw list.
+struct ImGuiToggleRetainedEntry
+{
+    ImGuiID Id;
+    int LastFrameUsed;
+    ImGuiToggleRetainedKey Key;
+    ImVec2 Origin;                          // Where the toggle was drawn, which the vertices are positioned around.
+    unsigned int VertexBase;                // The draw list vertex index the indices count from.
+    ImVector<ImDrawVert> Vertices;
+    ImVector<ImDrawIdx> Indices;
+};
+
+// ImGuiToggleRetainedCache: What each toggle drew last time, by ID, copied back into the draw list while the toggle's key is unchanged.
+//   When a toggle is drawn at the same place and vertex index as before, its vertices and indices are copied as they are.
+//   When it has moved, as when scrolling, the vertices are moved along with it, and the indices rebased if needed. Nothing is tessellated either way.
+//   Toggles that go unused for a while are evicted, and once the cache is full no new toggles are retained until some are evicted.
+struct ImGuiToggleRetainedCache
+{
+    ImVector<ImGuiToggleRetainedEntry> Entries;
+    ImGuiStorage EntryIndices;              // Id -> entry index.
+    int LastEvictionFrame = 0;
+
+    ~ImGuiToggleRetainedCache();
+
+    // Copies what the toggle with `id` drew last time into the draw list, moved to `origin`. Returns false if it was drawn with another key, or hasn't been drawn.
+    bool Draw(ImDrawList* draw_list, ImGuiID id, const ImGuiToggleRetainedKey& key, const ImVec2& origin, int frame_count);
+
+    // Marks where a toggle starts drawing, and captures what it drew from there once it's done.
+    // Nothing is captured if the toggle started a new draw command, as its indices wouldn't all count from the same vertex.
+    ImGuiToggleRetainedMark Mark(const ImDrawList* draw_list) const;
+    void Capture(const ImDrawList* draw_list, const ImGuiToggleRetainedMark& mark, ImGuiID id, const ImGuiToggleRetainedKey& key, const ImVec2& origin, int frame_count);
+
+    // Evicts toggles that haven't been drawn for a while. Called once a frame, it only does work every so often.
+    void EvictUnused(int frame_count);
+    void Clear();
+};
@@ -0,0 +1,417 @@
+#include "imgui_toggle_sprites.h"
+
+namespace
+{
+    // the radii, in texels, that discs are baked at. shapes are scaled from the nearest, so within this range each is drawn at most ~1.4x larger or smaller than baked.
+    // kept small, as every texel here is a texel added to the font atlas: about 22k in all, with the rings and shadows.
+    const float SpriteDiscRadii[] = { 4.0f, 8.0f, 16.0f, 32.0f };
+
+    // the radii, in texels, that rings are baked at, and the ratios of their outer radius to their thickness baked at each radius.
+    const float SpriteRingRadii[] = { 8.0f, 16.0f };
+    const float SpriteRingRatios[] = { 2.0f, 3.0f, 4.0f, 6.0f, 8.0f, 12.0f, 16.0f };
+
+    // the radius, in texels, that shadows are baked at, and the ratios of the shadowed corner's radius to the shadow's outer radius baked.
+    // the smallest is for square corners, where the shadow's corner is just its own width.
+    const float SpriteShadowRadius = 16.0f;
+    const float SpriteShadowCornerRatios[] = { 0.0f, 0.25f, 0.5f, 0.75f, 0.875f };
+
+    // transparent texels around each shape, so its anti-aliased edge isn't cut off, and filtering doesn't sample its neighbors.
+    const float SpritePadding = 1.0f;
+
+    // how far apart two sizes are, as a ratio: 1 when equal, and growing the further apart they are in either direction.
+    inline float GetSizeDistance(float a, float b)
+    {
+        return a > b ? a / b : b / a;
+    }
+
+    void AddSprite(ImVector<ImGuiToggleSprite>* sprites, ImFontAtlas* atlas, float radius, float thickness, bool is_shadow = false)
+    {
+        const int size = (int)((radius + SpritePadding) * 2.0f);
+
+        ImGuiToggleSprite sprite;
+        sprite.RectIndex = atlas->AddCustomRectRegular(size, size);
+        sprite.Radius = radius;
+        sprite.Thickness = thickness;
+        sprite.IsShadow = is_shadow;
+        sprite.UvMin = ImVec2(0.0f, 0.0f);
+        sprite.UvMax = ImVec2(0.0f, 0.0f);
+        sprites->push_back(sprite);
+    }
+
+    // the coverage of a sprite at `distance` texels from its center.
+    // discs and rings have a ramp one texel wide across each edge, to match draw list anti-aliasing. shadows fade out smoothly.
+    inline float GetSpriteCoverage(const ImGuiToggleSprite& sprite, float distance)
+    {
+        const float half_thickness = sprite.Thickness * 0.5f;
+
+        if (sprite.IsShadow)
+        {
+            const float inner_radius = sprite.Radius - sprite.Thickness;
+            if (distance < inner_radius)
+            {
+                return ImSaturate(distance - inner_radius + 1.0f);
+            }
+
+            const float fade = ImSaturate((distance - inner_radius) / sprite.Thickness);
+            return 1.0f - fade * fade * (3.0f - 2.0f * fade);
+        }
+
+        if (sprite.Thickness > 0.0f)
+        {
+            return ImSaturate(half_thickness + 0.5f - ImAbs(distance - (sprite.Radius - half_thickness)));
+        }
+
+        return ImSaturate(sprite.Radius + 0.5f - distance);
+    }
+
+    // draws a sprite's coverage into its rect.
+    void WriteSpritePixels(ImFontAtlas* atlas, const ImFontAtlasCustomRect& rect, const ImGuiToggleSprite& sprite)
+    {
+        const float center = sprite.Radius + ::SpritePadding;
+
+        for (int y = 0; y < rect.Height; ++y)
+        {
+            for (int x = 0; x < rect.Width; ++x)
+            {
+                const float dx = (float)x + 0.5f - center;
+                const float dy = (float)y + 0.5f - center;
+                const float coverage = ::GetSpriteCoverage(sprite, ImSqrt(dx * dx + dy * dy));
+                const unsigned char alpha = (unsigned char)(coverage * 255.0f + 0.5f);
+
+                const int pixel = (rect.Y + y) * atlas->TexWidth + (rect.X + x);
+                if (atlas->TexPixelsAlpha8 != nullptr)
+                {
+                    atlas->TexPixelsAlpha8[pixel] = alpha;
+                }
+                if (atlas->TexPixelsRGBA32 != nullptr)
+                {
+                    atlas->TexPixelsRGBA32[pixel] = IM_COL32(255, 255, 255, alpha);
+                }
+            }
+        }
+    }
+
+    // builds a single quad over the whole sprite, centered on the origin.
+    void BuildQuad(ImGuiToggleMeshTemplate* mesh, const ImGuiToggleSprite& sprite, float half_size)
+    {
+        mesh->Vertices.resize(4);
+        mesh->Vertices[0].pos = ImVec2(-half_size, -half_size);
+        mesh->Vertices[1].pos = ImVec2(half_size, -half_size);
+        mesh->Vertices[2].pos = ImVec2(half_size, half_size);
+        mesh->Vertices[3].pos = ImVec2(-half_size, half_size);
+        mesh->Vertices[0].uv = sprite.UvMin;
+        mesh->Vertices[1].uv = ImVec2(sprite.UvMax.x, sprite.UvMin.y);
+        mesh->Vertices[2].uv = sprite.UvMax;
+        mesh->Vertices[3].uv = ImVec2(sprite.UvMin.x, sprite.UvMax.y);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            mesh->Vertices[i].col = IM_COL32_A_MASK;
+        }
+
+        const ImDrawIdx indices[6] = { 0, 1, 2, 0, 2, 3 };
+        mesh->Indices.resize(6);
+        memcpy(mesh->Indices.Data, indices, sizeof(indices));
+    }
+
+    // builds a nine-slice over `bounds`: the corners are `corner` wide quadrants of the sprite, and the edges and center stretch its middle texels.
+    // `padding` is how far the sprite's transparent padding reaches outside the bounds, at the scale it's drawn at.
+    void BuildNineSlice(ImGuiToggleMeshTemplate* mesh, const ImGuiToggleSprite& sprite, const ImRect& bounds, float corner, float padding, bool fill_center)
+    {
+        const ImVec2 uv_center = (sprite.UvMin + sprite.UvMax) * 0.5f;
+        const float xs[4] = { bounds.Min.x - padding, bounds.Min.x + corner, bounds.Max.x - corner, bounds.Max.x + padding };
+        const float ys[4] = { bounds.Min.y - padding, bounds.Min.y + corner, bounds.Max.y - corner, bounds.Max.y + padding };
+        const float us[4] = { sprite.UvMin.x, uv_center.x, uv_center.x, sprite.UvMax.x };
+        const float vs[4] = { sprite.UvMin.y, uv_center.y, uv_center.y, sprite.UvMax.y };
+
+        mesh->Vertices.resize(16);
+        for (int y = 0; y < 4; ++y)
+        {
+            for (int x = 0; x < 4; ++x)
+            {
+                ImDrawVert& vertex = mesh->Vertices[y * 4 + x];
+                vertex.pos = ImVec2(xs[x], ys[y]);
+                vertex.uv = ImVec2(us[x], vs[y]);
+                vertex.col = IM_COL32_A_MASK;
+            }
+        }
+
+        // skip slices with no area, like the middle row of a pill, and the empty center of a ring.
+        mesh->Indices.resize(0);
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int column = 0; column < 3; ++column)
+            {
+                const bool is_center = row == 1 && column == 1;
+                if ((is_center && !fill_center) || xs[column + 1] <= xs[column] || ys[row + 1] <= ys[row])
+                {
+                    continue;
+                }
+
+                const ImDrawIdx top_left = (ImDrawIdx)(row * 4 + column);
+                mesh->Indices.push_back(top_left);
+                mesh->Indices.push_back((ImDrawIdx)(top_left + 1));
+                mesh->Indices.push_back((ImDrawIdx)(top_left + 5));
+                mesh->Indices.push_back(top_left);
+                mesh->Indices.push_back((ImDrawIdx)(top_left + 5));
+                mesh->Indices.push_back((ImDrawIdx)(top_left + 4));
+            }
+        }
+    }
+
+    // the corner rounding `ImDrawList::PathRect()` would actually use for a rectangle.
+    inline float GetRectRounding(const ImVec2& size, float rounding)
+    {
+        return ImMin(rounding, ImMin(ImAbs(size.x), ImAbs(size.y)) * 0.5f - 1.0f);
+    }
+} // namespace
+
+void ImGuiToggleSpriteAtlas::AddRects(ImFontAtlas* atlas)
+{
+    Clear();
+
+#if IMGUI_VERSION_NUM < 19200
+    Atlas = atlas;
+
+    for (float radius : ::SpriteDiscRadii)
+    {
+        ::AddSprite(&Discs, atlas, radius, 0.0f);
+    }
+
+    for (float radius : ::SpriteRingRadii)
+    {
+        // largest ratio first, so each radius's rings are sorted from thinnest to thickest.
+        for (int i = IM_ARRAYSIZE(::SpriteRingRatios) - 1; i >= 0; --i)
+        {
+            ::AddSprite(&Rings, atlas, radius, radius / ::SpriteRingRatios[i]);
+        }
+    }
+
+    // largest ratio first, so the shadows are sorted from thinnest to thickest.
+    for (int i = IM_ARRAYSIZE(::SpriteShadowCornerRatios) - 1; i >= 0; --i)
+    {
+        ::AddSprite(&Shadows, atlas, ::SpriteShadowRadius, ::SpriteShadowRadius * (1.0f - ::SpriteShadowCornerRatios[i]), true);
+    }
+#else
+    // dynamic font atlases move custom rects around as they grow, so sprites can't be baked once.
+    IM_UNUSED(atlas);
+    IM_ASSERT_USER_ERROR(false, "Toggle sprites require a Dear ImGui version before 1.92.");
+#endif
+}
+
+bool ImGuiToggleSpriteAtlas::Bake()
+{
+#if IMGUI_VERSION_NUM < 19200
+    if (Atlas == nullptr || !Atlas->IsBuilt())
+    {
+        return false;
+    }
+
+    ImVector<ImGuiToggleSprite>* sprite_lists[3] = { &Discs, &Rings, &Shadows };
+    for (ImVector<ImGuiToggleSprite>* sprites : sprite_lists)
+    {
+        for (ImGuiToggleSprite& sprite : *sprites)
+        {
+            const ImFontAtlasCustomRect* rect = Atlas->GetCustomRectByIndex(sprite.RectIndex);
+            if (!rect->IsPacked())
+            {
+                return false;
+            }
+
+            Atlas->CalcCustomRectUV(rect, &sprite.UvMin, &sprite.UvMax);
+            ::WriteSpritePixels(Atlas, *rect, sprite);
+        }
+    }
+
+    IsBaked = true;
+    return true;
+#else
+    return false;
+#endif
+}
+
+const ImGuiToggleSprite* ImGuiToggleSpriteAtlas::FindDisc(float radius) const
+{
+    const ImGuiToggleSprite* best = nullptr;
+
+    for (const ImGuiToggleSprite& sprite : Discs)
+    {
+        if (best == nullptr || ::GetSizeDistance(sprite.Radius, radius) < ::GetSizeDistance(best->Radius, radius))
+        {
+            best = &sprite;
+        }
+    }
+
+    return best;
+}
+
+const ImGuiToggleSprite* ImGuiToggleSpriteAtlas::FindRing(float outer_radius, float thickness) const
+{
+    // find the closest radius first, as that decides how sharp the edges are. then the closest thickness baked at that radius.
+    float best_radius = 0.0f;
+    for (const ImGuiToggleSprite& sprite : Rings)
+    {
+        if (best_radius == 0.0f || ::GetSizeDistance(sprite.Radius, outer_radius) < ::GetSizeDistance(best_radius, outer_radius))
+        {
+            best_radius = sprite.Radius;
+        }
+    }
+
+    // the thickness the ring would need, at the size it was baked.
+    const float baked_thickness = thickness * best_radius / outer_radius;
+
+    const ImGuiToggleSprite* best = nullptr;
+    for (const ImGuiToggleSprite& sprite : Rings)
+    {
+        if (sprite.Radius == best_radius
+            && (best == nullptr || ::GetSizeDistance(sprite.Thickness, baked_thickness) < ::GetSizeDistance(best->Thickness, baked_thickness)))
+        {
+            best = &sprite;
+        }
+    }
+
+    return best;
+}
+
+const ImGuiToggleSprite* ImGuiToggleSpriteAtlas::FindShadow(float outer_radius, float thickness) const
+{
+    // shadows scale smoothly, so only the shape matters: how much of the corner is the shadowed shape, and how much is shadow.
+    const float corner_ratio = 1.0f - thickness / outer_radius;
+
+    const ImGuiToggleSprite* best = nullptr;
+    float best_distance = 0.0f;
+    for (const ImGuiToggleSprite& sprite : Shadows)
+    {
+        const float distance = ImAbs((1.0f - sprite.Thickness / sprite.Radius) - corner_ratio);
+        if (best == nullptr || distance < best_distance)
+        {
+            best = &sprite;
+            best_distance = distance;
+        }
+    }
+
+    return best;
+}
+
+void ImGuiToggleSpriteAtlas::Clear()
+{
+    Atlas = nullptr;
+    Discs.clear();
+    Rings.clear();
+    Shadows.clear();
+    IsBaked = false;
+}
+
+bool ImGui::BuildToggleSpriteMesh(ImGuiToggleMeshTemplate* mesh, const ImGuiToggleSpriteAtlas& sprites, const ImGuiToggleMeshKey& key)
+{
+#if IMGUI_VERSION_NUM < 19200
+    // the sprites can only be drawn by a draw list that is drawing with the atlas's texture.
+    if (!sprites.IsBaked || key.TextureId != sprites.Atlas->TexID)
+    {
+        return false;
+    }
+
+    const float half_thickness = key.Thickness * 0.5f;
+
+    switch (key.Shape)
+    {
+    case ImGuiToggleMeshShape_CircleFilled:
+    {
+        const float radius = key.Size.x;
+        const ImGuiToggleSprite* sprite = sprites.FindDisc(radius);
+        if (radius < 0.5f || sprite == nullptr)
+        {
+            return false;
+        }
+
+        const float scale = radius / sprite->Radius;
+        ::BuildQuad(mesh, *sprite, (sprite->Radius + ::SpritePadding) * scale);
+        break;
+    }
+    case ImGuiToggleMeshShape_CircleStroke:
+    {
+        const float outer_radius = key.Size.x + half_thickness;
+        const ImGuiToggleSprite* sprite = sprites.FindRing(outer_radius, key.Thickness);
+        if (key.Size.x < 0.5f || key.Thickness <= 0.0f || sprite == nullptr)
+        {
+            return false;
+        }
+
+        const float scale = outer_radius / sprite->Radius;
+        ::BuildQuad(mesh, *sprite, (sprite->Radius + ::SpritePadding) * scale);
+        break;
+    }
+    case ImGuiToggleMeshShape_RectFilled:
+    {
+        // square corners are already only a couple of triangles.
+        const float rounding = ::GetRectRounding(key.Size, key.Rounding);
+        const ImGuiToggleSprite* sprite = sprites.FindDisc(rounding);
+        if (rounding < 0.5f || sprite == nullptr)
+        {
+            return false;
+        }
+
+        const float scale = rounding / sprite->Radius;
+        ::BuildNineSlice(mesh, *sprite, ImRect(ImVec2(0.0f, 0.0f), key.Size), rounding, ::SpritePadding * scale, true);
+        break;
+    }
+    case ImGuiToggleMeshShape_RectStroke:
+    {
+        // strokes are centered on the rectangle's edges, so the outside of the ring is half the thickness further out.
+        const float rounding = ::GetRectRounding(key.Size, key.Rounding);
+        const float outer_radius = rounding + half_thickness;
+        const ImGuiToggleSprite* sprite = sprites.FindRing(outer_radius, key.Thickness);
+        if (rounding < 0.5f || key.Thickness <= 0.0f || sprite == nullptr)
+        {
+            return false;
+        }
+
+        const float scale = outer_radius / sprite->Radius;
+        const ImRect bounds(ImVec2(-half_thickness, -half_thickness), key.Size + ImVec2(half_thickness, half_thickness));
+        ::BuildNineSlice(mesh, *sprite, bounds, outer_radius, ::SpritePadding * scale, false);
+        break;
+    }
+    case ImGuiToggleMeshShape_CircleShadow:
+    {
+        const float outer_radius = key.Size.x + key.Thickness;
+        const ImGuiToggleSprite* sprite = sprites.FindShadow(outer_radius, key.Thickness);
+        if (key.Thickness <= 0.0f || sprite == nullptr)
+        {
+            return false;
+        }
+
+        const float scale = outer_radius / sprite->Radius;
+        ::BuildQuad(mesh, *sprite, (sprite->Radius + ::SpritePadding) * scale);
+        break;
+    }
+    case ImGuiToggleMeshShape_RectShadow:
+    {
+        // unlike the other shapes, square corners are fine: the shadow's corners are rounded by its own width.
+        const float rounding = ImMax(::GetRectRounding(key.Size, key.Rounding), 0.0f);
+        const float outer_radius = rounding + key.Thickness;
+        const ImGuiToggleSprite* sprite = sprites.FindShadow(outer_radius, key.Thickness);
+        if (key.Thickness <= 0.0f || sprite == nullptr)
+        {
+            return false;
+        }
+
+        // the shadow's center is empty, and hidden under the shape anyway.
+        const float scale = outer_radius / sprite->Radius;
+        const ImRect bounds(ImVec2(-key.Thickness, -key.Thickness), key.Size + ImVec2(key.Thickness, key.Thickness));
+        ::BuildNineSlice(mesh, *sprite, bounds, outer_radius, ::SpritePadding * scale, false);
+        break;
+    }
+    default:
+        return false;
+    }
+
+    mesh->Key = key;
+    return true;
+#else
+    // sprites are never baked on 1.92 and later, so shapes are always tessellated.
+    IM_UNUSED(mesh);
+    IM_UNUSED(sprites);
+    IM_UNUSED(key);
+    return false;
+#endif
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif // IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+
+#include "imgui_toggle_mesh.h"
+
+// ImGuiToggleSprite: A round shape baked into a font atlas as a white, anti-aliased coverage mask.
+struct ImGuiToggleSprite
+{
+    int RectIndex;                          // The index of the atlas custom rect the sprite is baked into.
+    float Radius;                           // The outer radius of the shape, in texels. The rect is 1 texel wider on each side, for the anti-aliased edge.
+    float Thickness;                        // The thickness of a ring, or the width a shadow fades out over, in texels. 0 for a filled disc.
+    bool IsShadow;                          // A shadow, fading out from opaque at `Radius - Thickness`, and empty inside that.
+    ImVec2 UvMin;                           // The texture coordinates of the rect, once baked.
+    ImVec2 UvMax;
+};
+
+// ImGuiToggleSpriteAtlas: The discs and rings toggles are drawn with, baked into a font atlas so each shape draws as a few textured quads.
+//   Discs draw filled circles, and the corners of filled rounded rectangles nine-sliced around them. Rings do the same for borders, and shadows for shadows.
+//   Sprites are baked at a few sizes, and scaled from the nearest one. Rings are baked at a few thicknesses for each size, so drawn thicknesses are approximate.
+//   Shadows are smooth, so they're baked at one size and scaled freely, at a few ratios of the shadowed shape's corner to the shadow's width.
+struct ImGuiToggleSpriteAtlas
+{
+    ImFontAtlas* Atlas = nullptr;
+    ImVector<ImGuiToggleSprite> Discs;      // Sorted by radius.
+    ImVector<ImGuiToggleSprite> Rings;      // Sorted by radius, then by thickness.
+    ImVector<ImGuiToggleSprite> Shadows;    // Sorted by thickness.
+    bool IsBaked = false;
+
+    // Adds a custom rect to the atlas for every sprite. Call before the atlas is built.
+    void AddRects(ImFontAtlas* atlas);
+
+    // Draws every sprite into the built atlas's pixels. Returns false if the atlas isn't built, or the rects weren't packed.
+    bool Bake();
+
+    // Finds the sprite closest in size to a shape, or null if none were baked.
+    const ImGuiToggleSprite* FindDisc(float radius) const;
+    const ImGuiToggleSprite* FindRing(float outer_radius, float thickness) const;
+    const ImGuiToggleSprite* FindShadow(float outer_radius, float thickness) const;
+
+    void Clear();
+};
+
+namespace ImGui
+{
+    // Builds a mesh that draws a shape as textured quads over a baked sprite, in place of tessellating it.
+    // Returns false if the sprites aren't baked, the shape isn't round, or the key is for a draw list using another texture.
+    bool BuildToggleSpriteMesh(ImGuiToggleMeshTemplate* mesh, const ImGuiToggleSpriteAtlas& sprites, const ImGuiToggleMeshKey& key);
+}
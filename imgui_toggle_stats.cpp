@@ -0,0 +1,98 @@
+#include "imgui_toggle_stats.h"
+#include "imgui_toggle_context.h"
+
+void ImGuiToggleStatsHistory::NewFrame()
+{
+    LastFrame = Current;
+    Frames[NextFrame] = Current;
+    NextFrame = (NextFrame + 1) % FrameCount;
+    Current = ImGuiToggleStats();
+}
+
+#ifdef IMGUI_TOGGLE_ENABLE_STATS
+
+namespace
+{
+    // the counters shown in the stats window, in order.
+    struct StatsField
+    {
+        const char* Name;
+        int ImGuiToggleStats::* Counter;
+    };
+
+    const StatsField StatsFields[] =
+    {
+        { "Toggles", &ImGuiToggleStats::ToggleCount },
+        { "Clipped", &ImGuiToggleStats::ClippedCount },
+        { "Animating", &ImGuiToggleStats::AnimatingCount },
+        { "Retained", &ImGuiToggleStats::RetainedCount },
+        { "Vertices", &ImGuiToggleStats::VertexCount },
+        { "Indices", &ImGuiToggleStats::IndexCount },
+        { "Palette Blends", &ImGuiToggleStats::PaletteBlendCount },
+        { "Text Measures", &ImGuiToggleStats::TextMeasureCount },
+    };
+} // namespace
+
+const ImGuiToggleStats* ImGui::GetToggleStats()
+{
+    // don't create the toggle state just to report that nothing was drawn.
+    const ImGuiToggleContext* toggle_context = ImGui::FindToggleContext();
+    return toggle_context != nullptr ? &toggle_context->Stats.LastFrame : nullptr;
+}
+
+void ImGui::ShowToggleStatsWindow(bool* p_open /*= nullptr*/)
+{
+    if (!ImGui::Begin("Toggle Stats", p_open))
+    {
+        ImGui::End();
+        return;
+    }
+
+    const ImGuiToggleContext* toggle_context = ImGui::FindToggleContext();
+    if (toggle_context == nullptr)
+    {
+        ImGui::TextUnformatted("No toggles have been drawn in this context.");
+        ImGui::End();
+        return;
+    }
+
+    const ImGuiToggleStatsHistory& stats = toggle_context->Stats;
+    const int frame_count = ImGuiToggleStatsHistory::FrameCount;
+    float values[frame_count];
+
+    for (const StatsField& field : ::StatsFields)
+    {
+        // graph the ring from its oldest frame, scaled from zero to the highest count seen.
+        float max_value = 1.0f;
+        for (int i = 0; i < frame_count; ++i)
+        {
+            values[i] = (float)(stats.Frames[(stats.NextFrame + i) % frame_count].*field.Counter);
+            max_value = ImMax(max_value, values[i]);
+        }
+
+        char overlay[32];
+        ImFormatString(overlay, IM_ARRAYSIZE(overlay), "%d (max %d)", stats.LastFrame.*field.Counter, (int)max_value);
+        ImGui::PlotLines(field.Name, values, frame_count, 0, overlay, 0.0f, max_value, ImVec2(0.0f, ImGui::GetTextLineHeight() * 3.0f));
+    }
+
+    ImGui::End();
+}
+
+#else
+
+const ImGuiToggleStats* ImGui::GetToggleStats()
+{
+    return nullptr;
+}
+
+void ImGui::ShowToggleStatsWindow(bool* p_open /*= nullptr*/)
+{
+    if (ImGui::Begin("Toggle Stats", p_open))
+    {
+        ImGui::TextUnformatted("Toggle stats are disabled in this build.");
+    }
+
+    ImGui::End();
+}
+
+#endif // IMGUI_TOGGLE_ENABLE_STATS
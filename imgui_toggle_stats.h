@@ -0,0 +1,58 @@
+#pragma once
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif // IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+
+#include "imgui_toggle.h"
+
+// toggle stats are only counted when IMGUI_TOGGLE_ENABLE_STATS is defined, best in imconfig.h so every source file agrees.
+// only the counting compiles out: the stats are stored either way, so the layout of ImGuiToggleContext never depends on it.
+#ifdef IMGUI_TOGGLE_ENABLE_STATS
+
+// adds to a counter in an ImGuiToggleStats. compiles out, arguments and all, when stats are disabled.
+#define IMGUI_TOGGLE_STATS_ADD(stats, field, count) ((stats).field += (count))
+
+// counts the vertices and indices drawn into a draw list until the end of the enclosing scope.
+#define IMGUI_TOGGLE_STATS_DRAW_SCOPE(stats, draw_list) ImGuiToggleStatsDrawScope toggle_stats_draw_scope((stats), (draw_list))
+
+#else
+
+#define IMGUI_TOGGLE_STATS_ADD(stats, field, count) ((void)0)
+#define IMGUI_TOGGLE_STATS_DRAW_SCOPE(stats, draw_list) ((void)0)
+
+#endif // IMGUI_TOGGLE_ENABLE_STATS
+
+// ImGuiToggleStatsDrawScope: Adds what was drawn into a draw list while it was alive to a frame's stats.
+struct ImGuiToggleStatsDrawScope
+{
+    ImGuiToggleStats& Stats;
+    const ImDrawList* DrawList;
+    int VertexStart;
+    int IndexStart;
+
+    ImGuiToggleStatsDrawScope(ImGuiToggleStats& stats, const ImDrawList* draw_list)
+        : Stats(stats), DrawList(draw_list), VertexStart(draw_list->VtxBuffer.Size), IndexStart(draw_list->IdxBuffer.Size) {}
+
+    ~ImGuiToggleStatsDrawScope()
+    {
+        Stats.VertexCount += DrawList->VtxBuffer.Size - VertexStart;
+        Stats.IndexCount += DrawList->IdxBuffer.Size - IndexStart;
+    }
+};
+
+// ImGuiToggleStatsHistory: A context's stats, counted over the current frame, and kept for recent frames.
+struct ImGuiToggleStatsHistory
+{
+    static constexpr int FrameCount = 120;
+
+    ImGuiToggleStats Current;               // Counted over the frame in progress.
+    ImGuiToggleStats LastFrame;             // The last full frame.
+    ImGuiToggleStats Frames[FrameCount];    // A ring of the last full frames, oldest at `NextFrame`.
+    int NextFrame = 0;
+
+    // Keeps the current frame's counts, and starts counting a new frame.
+    void NewFrame();
+};
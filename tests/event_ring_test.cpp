@@ -0,0 +1,248 @@
+// Checks that ImGuiToggleEventRing keeps events in order as it wraps around, counts the events it drops while full, records nothing
+// once resized to 0, and hands every event from a producer thread to a consumer thread exactly once.
+
+#include "imgui.h"
+#include "imgui_toggle_events.h"
+
+#include <atomic>
+#include <climits>
+#include <cstdio>
+#include <thread>
+
+static ImGuiToggleEvent make_event(unsigned int index)
+{
+	ImGuiToggleEvent event;
+	event.Id = (ImGuiID)index;
+	event.Value = (index & 1) != 0;
+	event.Time = (double)index;
+	return event;
+}
+
+static bool is_event(const ImGuiToggleEvent& event, unsigned int index)
+{
+	return event.Id == (ImGuiID)index && event.Value == ((index & 1) != 0) && event.Time == (double)index;
+}
+
+// pushes and drains a few events at a time, so the head and tail pass the end of the ring many times over.
+static int test_wraparound(ImGuiToggleEventRing& ring, unsigned int start)
+{
+	ring.Resize(5);
+	if (ring.Capacity != 8)
+	{
+		printf("FAIL: capacity 5 rounded up to %u rather than 8\n", ring.Capacity);
+		return 1;
+	}
+
+	// the head and tail are free running, so start them just short of wrapping around the unsigned range too.
+	ring.Head.store(start, std::memory_order_relaxed);
+	ring.Tail.store(start, std::memory_order_relaxed);
+
+	int failures = 0;
+	unsigned int pushed = 0;
+	unsigned int drained = 0;
+	ImGuiToggleEvent out_events[8];
+
+	while (drained < 100)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			if (!ring.Push(make_event(pushed++)))
+			{
+				printf("FAIL: event %u was dropped with room in the ring\n", pushed - 1);
+				++failures;
+			}
+		}
+
+		const int count = ring.Drain(out_events, 8);
+		if (count != 3)
+		{
+			printf("FAIL: drained %d events rather than 3\n", count);
+			return failures + 1;
+		}
+
+		for (int i = 0; i < count; ++i)
+		{
+			if (!is_event(out_events[i], drained))
+			{
+				printf("FAIL: event %u came out of the ring wrong or out of order\n", drained);
+				++failures;
+			}
+			++drained;
+		}
+	}
+
+	if (ring.DroppedCount.load() != 0)
+	{
+		printf("FAIL: %u events counted as dropped with room in the ring\n", ring.DroppedCount.load());
+		++failures;
+	}
+
+	return failures;
+}
+
+// fills the ring, and checks the events pushed past its capacity are dropped and counted, and the ones already in it are kept.
+static int test_dropped(ImGuiToggleEventRing& ring)
+{
+	ring.Resize(8);
+
+	int failures = 0;
+	for (unsigned int i = 0; i < 8; ++i)
+	{
+		if (!ring.Push(make_event(i)))
+		{
+			printf("FAIL: event %u was dropped before the ring was full\n", i);
+			++failures;
+		}
+	}
+
+	for (unsigned int i = 8; i < 11; ++i)
+	{
+		if (ring.Push(make_event(i)))
+		{
+			printf("FAIL: event %u was recorded into a full ring\n", i);
+			++failures;
+		}
+	}
+
+	if (ring.DroppedCount.load() != 3)
+	{
+		printf("FAIL: %u events counted as dropped rather than 3\n", ring.DroppedCount.load());
+		++failures;
+	}
+
+	ImGuiToggleEvent out_events[16];
+	const int count = ring.Drain(out_events, 16);
+	if (count != 8)
+	{
+		printf("FAIL: drained %d events from a full ring rather than 8\n", count);
+		return failures + 1;
+	}
+
+	for (int i = 0; i < count; ++i)
+	{
+		if (!is_event(out_events[i], (unsigned int)i))
+		{
+			printf("FAIL: event %d of a full ring came out wrong or out of order\n", i);
+			++failures;
+		}
+	}
+
+	// and once drained, there's room again.
+	if (!ring.Push(make_event(11)) || ring.Drain(out_events, 16) != 1 || !is_event(out_events[0], 11))
+	{
+		printf("FAIL: a drained ring didn't record a new event\n");
+		++failures;
+	}
+
+	return failures;
+}
+
+// resizes the ring to 0, and checks nothing is recorded or counted as dropped.
+static int test_disabled(ImGuiToggleEventRing& ring)
+{
+	ring.Resize(8);
+	ring.Push(make_event(0));
+	ring.Resize(0);
+
+	int failures = 0;
+	if (ring.IsEnabled() || ring.Events != nullptr)
+	{
+		printf("FAIL: a ring resized to 0 is still enabled\n");
+		++failures;
+	}
+
+	if (ring.Push(make_event(1)))
+	{
+		printf("FAIL: a ring resized to 0 recorded an event\n");
+		++failures;
+	}
+
+	ImGuiToggleEvent out_events[8];
+	if (ring.Drain(out_events, 8) != 0)
+	{
+		printf("FAIL: a ring resized to 0 kept or recorded events\n");
+		++failures;
+	}
+
+	if (ring.DroppedCount.load() != 0)
+	{
+		printf("FAIL: a ring resized to 0 counted events as dropped\n");
+		++failures;
+	}
+
+	return failures;
+}
+
+// a producer pushes events as fast as it can, retrying the ones dropped, while a consumer drains them.
+// every event must come out exactly once and in order, and every retry must have been counted as a drop.
+static int test_threads(ImGuiToggleEventRing& ring)
+{
+	const unsigned int event_count = 200000;
+	ring.Resize(64);
+
+	unsigned int producer_drops = 0;
+	std::thread producer([&ring, &producer_drops, event_count]()
+	{
+		for (unsigned int i = 0; i < event_count; ++i)
+		{
+			while (!ring.Push(make_event(i)))
+			{
+				++producer_drops;
+				std::this_thread::yield();
+			}
+		}
+	});
+
+	int failures = 0;
+	unsigned int drained = 0;
+	ImGuiToggleEvent out_events[16];
+	while (drained < event_count)
+	{
+		const int count = ring.Drain(out_events, 16);
+		if (count == 0)
+		{
+			std::this_thread::yield();
+		}
+
+		for (int i = 0; i < count; ++i)
+		{
+			if (!is_event(out_events[i], drained) && failures++ < 10)
+			{
+				printf("FAIL: event %u came out as event %u\n", drained, out_events[i].Id);
+			}
+			++drained;
+		}
+	}
+
+	producer.join();
+
+	ImGuiToggleEvent extra_event;
+	if (ring.Drain(&extra_event, 1) != 0)
+	{
+		printf("FAIL: events were left over after every event was drained\n");
+		++failures;
+	}
+
+	if (ring.DroppedCount.load() != producer_drops)
+	{
+		printf("FAIL: %u events counted as dropped, but %u pushes failed\n", ring.DroppedCount.load(), producer_drops);
+		++failures;
+	}
+
+	return failures;
+}
+
+int main()
+{
+	int failures = 0;
+
+	ImGuiToggleEventRing ring;
+	failures += test_wraparound(ring, 0);
+	failures += test_wraparound(ring, UINT_MAX - 20);
+	failures += test_dropped(ring);
+	failures += test_disabled(ring);
+	failures += test_threads(ring);
+
+	printf("%s: %d failures\n", failures == 0 ? "PASS" : "FAIL", failures);
+	return failures == 0 ? 0 : 1;
+}
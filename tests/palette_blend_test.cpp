@@ -0,0 +1,99 @@
+// Checks that ImGui::BlendResolvedPalettesN() gives exactly the same colors as ImGui::BlendResolvedPalettes(), for every count and blend amount.
+// Built once as usual, testing the SSE2 or NEON path where the target has one, and once with IMGUI_TOGGLE_DISABLE_SIMD, testing the plain C++ path.
+
+#include "imgui.h"
+#include "imgui_toggle_palette.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static ImGuiToggleResolvedPalette make_palette(ImU32 seed)
+{
+	ImGuiToggleResolvedPalette palette;
+	ImU32* colors = reinterpret_cast<ImU32*>(&palette);
+
+	for (size_t i = 0; i < sizeof(palette) / sizeof(ImU32); ++i)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		colors[i] = seed;
+	}
+
+	return palette;
+}
+
+// blends every amount both ways, returning how many palettes differ.
+static int count_mismatches(const ImGuiToggleResolvedPalette& a, const ImGuiToggleResolvedPalette& b, const std::vector<float>& blend_amounts)
+{
+	const int count = (int)blend_amounts.size();
+	std::vector<ImGuiToggleResolvedPalette> expected(count);
+	std::vector<ImGuiToggleResolvedPalette> results(count);
+
+	for (int i = 0; i < count; ++i)
+	{
+		ImGui::BlendResolvedPalettes(&expected[i], a, b, blend_amounts[i]);
+	}
+
+	ImGui::BlendResolvedPalettesN(results.data(), a, b, blend_amounts.data(), count);
+
+	int mismatches = 0;
+	for (int i = 0; i < count; ++i)
+	{
+		if (memcmp(&expected[i], &results[i], sizeof(ImGuiToggleResolvedPalette)) != 0)
+		{
+			printf("FAIL: blend amount %.9g gives different colors\n", blend_amounts[i]);
+			++mismatches;
+		}
+	}
+
+	return mismatches;
+}
+
+int main()
+{
+	int failures = 0;
+
+	// black to white and back, and palettes with every channel set, exercise the ends of each channel's range.
+	const ImGuiToggleResolvedPalette palettes[] =
+	{
+		make_palette(1),
+		make_palette(2),
+		make_palette(0xDEADBEEF),
+	};
+	ImGuiToggleResolvedPalette black;
+	ImGuiToggleResolvedPalette white;
+	memset(&black, 0x00, sizeof(black));
+	memset(&white, 0xFF, sizeof(white));
+
+	// every blend amount a weight can round to, and then some, including both ends and amounts past them.
+	std::vector<float> blend_amounts;
+	for (int i = 0; i <= 4096; ++i)
+	{
+		blend_amounts.push_back((float)i / 4096.0f);
+	}
+	blend_amounts.push_back(-0.25f);
+	blend_amounts.push_back(1.25f);
+	blend_amounts.push_back(1e-7f);
+	blend_amounts.push_back(1.0f - 1e-7f);
+
+	for (const ImGuiToggleResolvedPalette& a : palettes)
+	{
+		for (const ImGuiToggleResolvedPalette& b : palettes)
+		{
+			failures += count_mismatches(a, b, blend_amounts);
+		}
+	}
+
+	failures += count_mismatches(black, white, blend_amounts);
+	failures += count_mismatches(white, black, blend_amounts);
+
+	// counts that leave a partial batch, for implementations that blend a few palettes at a time.
+	for (int count = 0; count <= 17; ++count)
+	{
+		const std::vector<float> some_amounts(blend_amounts.begin() + 1000, blend_amounts.begin() + 1000 + count);
+		failures += count_mismatches(palettes[0], palettes[1], some_amounts);
+	}
+
+	printf("%s: %d mismatches\n", failures == 0 ? "PASS" : "FAIL", failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,176 @@
+// Checks that toggles drawn with sprites baked into the font atlas cover the same area as tessellated toggles, with fewer vertices.
+// Sprites need Dear ImGui before 1.92, so the test is skipped on later versions.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+
+static const int Count = 64;
+static const int Columns = 8;
+
+// sprites are scaled from the nearest size baked, so their edges may land a little inside or outside the tessellated ones.
+static const float BoundsTolerance = 2.0f;
+
+// the test's own exit code for a skipped test, as passed to CTest's SKIP_RETURN_CODE.
+static const int SkipReturnCode = 77;
+
+struct SpriteCase
+{
+	const char* Name;
+	ImGuiToggleFlags Flags;
+	ImGuiToggleA11yStyle A11yStyle;
+	bool CompareBounds;                     // Shadows are blurred sprites rather than stroked, so they don't reach as far.
+};
+
+struct DrawResult
+{
+	bool Baked;
+	int Vertices;
+	int SpriteVertices;                     // Vertices sampling the atlas away from its white pixel.
+	ImVec2 Min;
+	ImVec2 Max;
+};
+
+static DrawResult draw_toggles(const SpriteCase& sprite_case, bool use_sprites)
+{
+	DrawResult result;
+	result.Baked = false;
+	result.Vertices = 0;
+	result.SpriteVertices = 0;
+	result.Min = ImVec2(FLT_MAX, FLT_MAX);
+	result.Max = ImVec2(-FLT_MAX, -FLT_MAX);
+
+	ImGui::CreateContext();
+	ImGuiIO& io = ImGui::GetIO();
+	io.DisplaySize = ImVec2(1280.0f, 720.0f);
+	io.DeltaTime = 1.0f / 60.0f;
+
+	// tessellated lines would otherwise sample the atlas's baked lines, and be counted as sprites.
+	ImGui::GetStyle().AntiAliasedLinesUseTex = false;
+
+	if (use_sprites)
+	{
+		ImGui::AddToggleSpritesToFontAtlas();
+	}
+
+	unsigned char* pixels = nullptr;
+	int width = 0, height = 0;
+	io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+	if (use_sprites)
+	{
+		result.Baked = ImGui::BakeToggleSprites();
+	}
+
+	ImGuiToggleConfig config;
+	config.Flags = sprite_case.Flags;
+	config.A11yStyle = sprite_case.A11yStyle;
+
+	bool values[Count];
+	for (int i = 0; i < Count; ++i)
+	{
+		values[i] = (i % 2) == 0;
+	}
+
+	// a couple of frames, so anything cached on the first is used on the last.
+	for (int frame = 0; frame < 3; ++frame)
+	{
+		ImGui::NewFrame();
+		ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+		ImGui::SetNextWindowSize(io.DisplaySize);
+		ImGui::Begin("Sprites", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoBackground);
+
+		for (int i = 0; i < Count; ++i)
+		{
+			if (i % Columns != 0)
+			{
+				ImGui::SameLine();
+			}
+
+			ImGui::PushID(i);
+			ImGui::Toggle("##value", &values[i], config);
+			ImGui::PopID();
+		}
+
+		ImGui::End();
+		ImGui::Render();
+	}
+
+	// the window has no background or decorations, so every vertex drawn is a toggle's.
+	const ImDrawData* draw_data = ImGui::GetDrawData();
+	const ImVec2 white_pixel = io.Fonts->TexUvWhitePixel;
+	for (int i = 0; i < draw_data->CmdListsCount; ++i)
+	{
+		const ImDrawList* draw_list = draw_data->CmdLists[i];
+		for (int v = 0; v < draw_list->VtxBuffer.Size; ++v)
+		{
+			const ImDrawVert& vertex = draw_list->VtxBuffer[v];
+			result.SpriteVertices += (vertex.uv.x != white_pixel.x || vertex.uv.y != white_pixel.y) ? 1 : 0;
+			result.Min = ImVec2(std::min(result.Min.x, vertex.pos.x), std::min(result.Min.y, vertex.pos.y));
+			result.Max = ImVec2(std::max(result.Max.x, vertex.pos.x), std::max(result.Max.y, vertex.pos.y));
+		}
+
+		result.Vertices += draw_list->VtxBuffer.Size;
+	}
+
+	ImGui::DestroyContext();
+	return result;
+}
+
+static bool check(bool condition, const SpriteCase& sprite_case, const char* message)
+{
+	if (!condition)
+	{
+		printf("FAIL: %s: %s\n", sprite_case.Name, message);
+	}
+
+	return condition;
+}
+
+int main()
+{
+#if IMGUI_VERSION_NUM >= 19200
+	printf("SKIP: toggle sprites need Dear ImGui before 1.92\n");
+	return SkipReturnCode;
+#else
+	const SpriteCase cases[] =
+	{
+		{ "default", ImGuiToggleFlags_None, ImGuiToggleA11yStyle_Default, true },
+		{ "bordered", ImGuiToggleFlags_Bordered, ImGuiToggleA11yStyle_Default, true },
+		{ "shadowed", ImGuiToggleFlags_Shadowed, ImGuiToggleA11yStyle_Default, false },
+		{ "bordered_shadowed", ImGuiToggleFlags_Bordered | ImGuiToggleFlags_Shadowed, ImGuiToggleA11yStyle_Default, false },
+		{ "a11y_glyph", ImGuiToggleFlags_A11y, ImGuiToggleA11yStyle_Glyph, true },
+	};
+
+	int failures = 0;
+	for (const SpriteCase& sprite_case : cases)
+	{
+		const DrawResult tessellated = draw_toggles(sprite_case, false);
+		const DrawResult sprites = draw_toggles(sprite_case, true);
+
+		bool passed = true;
+		passed &= check(sprites.Baked, sprite_case, "sprites were not baked");
+		passed &= check(tessellated.SpriteVertices == 0, sprite_case, "tessellated toggles sampled the atlas");
+		passed &= check(sprites.SpriteVertices > 0, sprite_case, "no toggle was drawn with sprites");
+		passed &= check(sprites.Vertices < tessellated.Vertices, sprite_case, "sprites did not draw fewer vertices");
+
+		if (sprite_case.CompareBounds)
+		{
+			const bool bounds_match = fabsf(sprites.Min.x - tessellated.Min.x) <= BoundsTolerance
+				&& fabsf(sprites.Min.y - tessellated.Min.y) <= BoundsTolerance
+				&& fabsf(sprites.Max.x - tessellated.Max.x) <= BoundsTolerance
+				&& fabsf(sprites.Max.y - tessellated.Max.y) <= BoundsTolerance;
+			passed &= check(bounds_match, sprite_case, "sprites did not cover the same area as tessellated toggles");
+		}
+
+		printf("%s: %s: %d vertices tessellated, %d with sprites\n", passed ? "PASS" : "FAIL", sprite_case.Name, tessellated.Vertices, sprites.Vertices);
+		failures += passed ? 0 : 1;
+	}
+
+	return failures == 0 ? 0 : 1;
+#endif
+}
@@ -0,0 +1,237 @@
+// Checks that ImGui::ToggleList() filters more rows than it scans in one frame, picks up rows appended to the source, starts over when the filter changes,
+// and that a list's index is evicted once it goes undrawn while another list drawn all along keeps its own.
+
+#include "imgui.h"
+#include "imgui_toggle.h"
+#include "imgui_toggle_context.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// more rows than a list checks against its filter in one frame, so matches take two frames to find.
+static const int RowCount = 100000;
+static const int AppendedCount = 50;
+static const int SmallRowCount = 100;
+
+struct TestSource
+{
+	int Count;
+	char Label[32];
+	int LabelCalls;                         // How many labels were asked for since last reset.
+	std::vector<int> DrawnRows;             // The rows whose values were asked for since last reset, which are those drawn.
+};
+
+// every seventh row's label contains "Match". every fifth row has "match" in its label too, but after "##", so it isn't visible and doesn't match.
+static void format_label(char* buffer, size_t buffer_size, int row)
+{
+	if (row % 7 == 0)
+	{
+		snprintf(buffer, buffer_size, "Match %d", row);
+	}
+	else if (row % 5 == 0)
+	{
+		snprintf(buffer, buffer_size, "row %d##match", row);
+	}
+	else
+	{
+		snprintf(buffer, buffer_size, "row %d", row);
+	}
+}
+
+static const char* get_label(void* user_data, int row)
+{
+	TestSource* source = static_cast<TestSource*>(user_data);
+	++source->LabelCalls;
+	format_label(source->Label, sizeof(source->Label), row);
+	return source->Label;
+}
+
+static bool get_value(void* user_data, int row)
+{
+	TestSource* source = static_cast<TestSource*>(user_data);
+	source->DrawnRows.push_back(row);
+	return false;
+}
+
+static void set_value(void* user_data, int row, bool value)
+{
+	IM_UNUSED(user_data);
+	IM_UNUSED(row);
+	IM_UNUSED(value);
+}
+
+static ImGuiToggleListSource make_list_source(TestSource* source)
+{
+	ImGuiToggleListSource list_source;
+	list_source.Count = source->Count;
+	list_source.GetLabel = get_label;
+	list_source.GetValue = get_value;
+	list_source.SetValue = set_value;
+	list_source.UserData = source;
+	return list_source;
+}
+
+// the rows of the first `scanned_count` that `filter` should match, worked out from the labels directly.
+static std::vector<int> expected_matches(const char* filter, int scanned_count)
+{
+	std::vector<int> matches;
+	for (int row = 0; row < scanned_count; ++row)
+	{
+		char label[32];
+		format_label(label, sizeof(label), row);
+		if (strcmp(filter, "match") == 0 ? row % 7 == 0 : strncmp(label, filter, strlen(filter)) == 0)
+		{
+			matches.push_back(row);
+		}
+	}
+
+	return matches;
+}
+
+static const ImGuiToggleListIndex* find_index(int count)
+{
+	const ImGuiToggleListCache& lists = ImGui::GetToggleContext()->Lists;
+	for (const ImGuiToggleListIndex& index : lists.Indices)
+	{
+		if (index.Count == count)
+		{
+			return &index;
+		}
+	}
+
+	return nullptr;
+}
+
+static void draw_frame(TestSource* big_source, const char* big_filter, TestSource* small_source)
+{
+	big_source->LabelCalls = 0;
+	big_source->DrawnRows.clear();
+	small_source->LabelCalls = 0;
+	small_source->DrawnRows.clear();
+
+	ImGui::NewFrame();
+	ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+	ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+	ImGui::Begin("Lists", nullptr, ImGuiWindowFlags_NoDecoration);
+
+	ImGui::ToggleList("big", make_list_source(big_source), big_filter, ImVec2(0.0f, 200.0f));
+	if (small_source->Count > 0)
+	{
+		ImGui::ToggleList("small", make_list_source(small_source), "match", ImVec2(0.0f, 200.0f));
+	}
+
+	ImGui::End();
+	ImGui::Render();
+}
+
+static int check(bool condition, const char* message)
+{
+	if (!condition)
+	{
+		printf("FAIL: %s\n", message);
+	}
+
+	return condition ? 0 : 1;
+}
+
+// checks a list's index against the matches expected, and that the rows drawn are the first of them.
+static int check_index(const TestSource& source, const char* filter, int scanned_count, const char* what)
+{
+	const ImGuiToggleListIndex* index = find_index(source.Count);
+	if (index == nullptr)
+	{
+		printf("FAIL: %s: the list has no index\n", what);
+		return 1;
+	}
+
+	int failures = 0;
+	if (index->ScannedCount != scanned_count)
+	{
+		printf("FAIL: %s: %d rows checked against the filter rather than %d\n", what, index->ScannedCount, scanned_count);
+		++failures;
+	}
+
+	const std::vector<int> expected = expected_matches(filter, scanned_count);
+	if (index->Matches.Size != (int)expected.size() || memcmp(index->Matches.Data, expected.data(), expected.size() * sizeof(int)) != 0)
+	{
+		printf("FAIL: %s: %d rows matched rather than the %d expected\n", what, index->Matches.Size, (int)expected.size());
+		++failures;
+	}
+
+	if (source.DrawnRows.empty() || source.DrawnRows.size() > expected.size() || !std::equal(source.DrawnRows.begin(), source.DrawnRows.end(), expected.begin()))
+	{
+		printf("FAIL: %s: the rows drawn aren't the first matches\n", what);
+		++failures;
+	}
+
+	return failures;
+}
+
+int main()
+{
+	ImGui::CreateContext();
+	ImGuiIO& io = ImGui::GetIO();
+	io.DisplaySize = ImVec2(1280.0f, 720.0f);
+	io.DeltaTime = 1.0f / 60.0f;
+
+	unsigned char* pixels = nullptr;
+	int width = 0, height = 0;
+	io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+	int failures = 0;
+
+	TestSource big_source;
+	big_source.Count = RowCount;
+	TestSource small_source;
+	small_source.Count = SmallRowCount;
+
+	// the first frame only gets through part of the rows, and the list shows the matches found so far.
+	draw_frame(&big_source, "match", &small_source);
+	failures += check(ImGui::ToggleAnimationsPending(), "a list still finding matches isn't pending");
+	failures += check_index(big_source, "match", 1 << 16, "first frame");
+	failures += check_index(small_source, "match", SmallRowCount, "small list");
+
+	// the second gets through the rest.
+	draw_frame(&big_source, "match", &small_source);
+	failures += check(!ImGui::ToggleAnimationsPending(), "a list that found every match is still pending");
+	failures += check_index(big_source, "match", RowCount, "second frame");
+
+	// rows appended to the source are checked on their own, without starting over.
+	big_source.Count = RowCount + AppendedCount;
+	draw_frame(&big_source, "match", &small_source);
+	failures += check_index(big_source, "match", RowCount + AppendedCount, "appended rows");
+	failures += check(big_source.LabelCalls <= AppendedCount + (int)big_source.DrawnRows.size(), "appending rows checked the old rows again");
+
+	// a new filter starts over, again over two frames.
+	draw_frame(&big_source, "row 1", &small_source);
+	failures += check_index(big_source, "row 1", 1 << 16, "new filter, first frame");
+	draw_frame(&big_source, "row 1", &small_source);
+	failures += check_index(big_source, "row 1", RowCount + AppendedCount, "new filter, second frame");
+
+	// stop drawing the small list for long enough that its index is evicted, while the big list keeps its own.
+	const int small_count = small_source.Count;
+	small_source.Count = 0;
+	for (int frame = 0; frame < 130; ++frame)
+	{
+		draw_frame(&big_source, "row 1", &small_source);
+	}
+
+	failures += check(find_index(small_count) == nullptr, "the undrawn list's index wasn't evicted");
+	failures += check(ImGui::GetToggleContext()->Lists.Indices.Size == 1, "the cache kept more than the drawn list's index");
+	failures += check_index(big_source, "row 1", RowCount + AppendedCount, "kept list after eviction");
+	failures += check(big_source.LabelCalls == (int)big_source.DrawnRows.size(), "the kept list checked its rows again after eviction");
+
+	// drawing the evicted list again finds its matches from scratch, and the kept list is still looked up as before.
+	small_source.Count = small_count;
+	draw_frame(&big_source, "row 1", &small_source);
+	failures += check_index(small_source, "match", SmallRowCount, "evicted list drawn again");
+	failures += check_index(big_source, "row 1", RowCount + AppendedCount, "kept list beside the evicted one");
+	failures += check(big_source.LabelCalls == (int)big_source.DrawnRows.size(), "the kept list checked its rows again beside the evicted one");
+
+	ImGui::DestroyContext();
+
+	printf("%s: %d failures\n", failures == 0 ? "PASS" : "FAIL", failures);
+	return failures == 0 ? 0 : 1;
+}